@@ -0,0 +1,17 @@
+#version 410 core
+
+in vec3 vTexCoord;
+in vec3 vNormal;
+in float vAmbientOcclusion;
+
+uniform sampler2DArray uBlockTextures;
+uniform vec3 uLightDirection;  // 光源へ向かう単位ベクトル
+
+out vec4 fragColor;
+
+void main() {
+    vec4 albedo = texture(uBlockTextures, vTexCoord);
+    float diffuse = max(dot(normalize(vNormal), uLightDirection), 0.0);
+    float ao = mix(0.4, 1.0, vAmbientOcclusion);
+    fragColor = vec4(albedo.rgb * (0.35 + 0.65 * diffuse) * ao, albedo.a);
+}
\ No newline at end of file
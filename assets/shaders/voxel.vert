@@ -0,0 +1,36 @@
+#version 410 core
+
+// PackedVoxelVertex（include/render/VoxelVertex.hpp）の展開
+// word0: 位置 x,y,z (5bit×3) / 法線 (3bit) / AO (2bit) / 角 u,v (1bit×2) / 幅-1 (4bit) / 高さ-1 (4bit)
+// word1: テクスチャ層 (16bit) / 予約 (16bit)
+layout(location = 0) in uvec2 aPacked;
+
+uniform mat4 uViewProjection;
+uniform vec3 uChunkOrigin;  // チャンク（LOD領域）のワールド座標（ブロック単位）
+uniform float uChunkScale;  // LODレベルの拡大率（2^level、通常のチャンクは1）
+
+out vec3 vTexCoord;  // xy: 面内UV（ブロック単位で繰り返す）, z: テクスチャ層
+out vec3 vNormal;
+out float vAmbientOcclusion;
+
+const vec3 kNormals[6] = vec3[6](
+    vec3( 1.0,  0.0,  0.0), vec3(-1.0,  0.0,  0.0),
+    vec3( 0.0,  1.0,  0.0), vec3( 0.0, -1.0,  0.0),
+    vec3( 0.0,  0.0,  1.0), vec3( 0.0,  0.0, -1.0)
+);
+
+void main() {
+    uint word0 = aPacked.x;
+    uint word1 = aPacked.y;
+    
+    vec3 position = vec3(float(word0 & 31u), float((word0 >> 5u) & 31u), float((word0 >> 10u) & 31u));
+    uint normalIndex = (word0 >> 15u) & 7u;
+    uint ao = (word0 >> 18u) & 3u;
+    vec2 corner = vec2(float((word0 >> 20u) & 1u), float((word0 >> 21u) & 1u));
+    vec2 size = vec2(float(((word0 >> 22u) & 15u) + 1u), float(((word0 >> 26u) & 15u) + 1u));
+    
+    vTexCoord = vec3(corner * size, float(word1 & 0xFFFFu));
+    vNormal = kNormals[normalIndex];
+    vAmbientOcclusion = float(ao) / 3.0;
+    gl_Position = uViewProjection * vec4(uChunkOrigin + position * uChunkScale, 1.0);
+}
\ No newline at end of file
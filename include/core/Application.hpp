@@ -1,32 +1,198 @@
 #pragma once
 
 #include "core/Exception.hpp"
+#include "core/FixedTimestep.hpp"
+#include "core/FrameAllocator.hpp"
+#include "core/FrameTimeRecorder.hpp"
+#include "core/IWindow.hpp"
+#include "core/JobSystem.hpp"
+#include "core/LatencyHistogram.hpp"
+#include "core/LogSystem.hpp"
+#include "core/StartupTrace.hpp"
+#include "world/ChunkLod.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/ChunkStreamer.hpp"
+#include "world/LightEngine.hpp"
+#include "world/TerrainGenerator.hpp"
+#include "render/GreedyMesher.hpp"
+#include "render/MeshingPipeline.hpp"
+#include "render/RenderCommandList.hpp"
+#include "render/RenderThread.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace BoxelGame {
 
-class Window;
+// 起動時にジョブワーカーで実行する非GL初期化処理（アセット読み込み・スポーン地点生成・設定解析等）
+// ウィンドウ・GLコンテキスト作成と並行して実行され、全完了後にコンストラクタが戻る
+struct StartupTask {
+    std::string name;
+    std::function<void()> run;
+};
+
+// アプリケーション起動設定
+struct ApplicationConfig {
+    double tickRate = 60.0;      // シミュレーション更新頻度（Hz）
+    int maxTicksPerFrame = 5;    // 1フレームで追いつき処理するtick数の上限
+    std::string profileOutputPath;       // 空でなければメインループ終了時にChrome Traceを出力
+    std::uint32_t profileFrameCount = 120; // 出力する直近フレーム数
+    unsigned workerThreadCount = 0;        // ジョブシステムのワーカー数（0はハードウェア並列数-1）
+    PresentMode presentMode = PresentMode::VSync; // Immediateでフレームレート上限無し（ベンチマーク用）
+    LoggingConfig logging;                 // 非同期ログ設定
+    bool threadedRendering = true;         // 描画スレッドでGL実行・提示を行う（falseでメインスレッド直列）
+    std::size_t renderBufferCount = 3;     // 描画コマンドリスト数（2: ダブルバッファ, 3: トリプルバッファ）
+    std::size_t frameArenaBytes = 1 << 20; // スレッドごとの1フレーム用アリーナ容量
+    std::size_t meshJobsInFlight = 64;     // 同時に実行するチャンクメッシュ生成ジョブ数の上限
+    std::vector<StartupTask> startupTasks; // ウィンドウ作成と並行して実行する起動タスク
+    double startupBudgetSeconds = 5.0;     // 起動時間の目標（仕様: ワールド初期化5秒以内）
+    // スポーン周辺のワールドを生成して読み込む（内側の範囲のメッシュ化を待って最初のフレームを描画し、
+    // 残りは描画と並行してリング順に読み込む）
+    bool streamWorld = false;
+    TerrainSettings terrain;
+    ChunkStreamingConfig streaming;
+};
 
 class Application {
 public:
+    // GLFWウィンドウを生成して起動
     Application();
+    // 外部からウィンドウを注入して起動（HeadlessWindow/MockWindow等、nullptrの場合はGLFWウィンドウを生成）
+    explicit Application(std::unique_ptr<IWindow> window, const ApplicationConfig& config = {});
     ~Application();
-
+    
     // コピー・ムーブ操作を削除（RAII/一意所有権）
     Application(const Application&) = delete;
     Application& operator=(const Application&) = delete;
     Application(Application&&) = delete;
     Application& operator=(Application&&) = delete;
-
+    
+    // ウィンドウが閉じられるまで実行
     void Run();
+    // 指定フレーム数（またはウィンドウが閉じられるまで）実行
+    void RunFrames(std::uint64_t frameCount);
+    
+    // 直近frameCountフレームのプロファイルをChrome Trace JSONとして出力
+    bool ExportProfile(const std::string& path, std::uint32_t frameCount) const;
+    
+    // 起動フェーズ別の所要時間（コンストラクタ完了時点で計測終了）
+    const StartupTrace& GetStartupTrace() const { return m_startup_trace; }
+    std::uint64_t GetFrameCount() const { return m_frame_count; }
+    std::uint64_t GetTickCount() const { return m_timestep.GetTickCount(); }
+    IWindow& GetWindow() { return *m_window; }
+    JobSystem& GetJobSystem() { return *m_job_system; }
+    // メインスレッド用の1フレーム用アリーナ（確保したメモリはフレーム終了時に一括解放される）
+    // ジョブからはGetFrameAllocator().ParallelForで渡される実行スレッドのアリーナを使うこと
+    LinearArena& GetFrameArena();
+    FrameAllocator& GetFrameAllocator() { return *m_frame_allocator; }
+    const FrameAllocator& GetFrameAllocator() const { return *m_frame_allocator; }
+    ChunkManager& GetChunkManager() { return m_chunks; }
+    MeshingPipeline& GetMeshingPipeline() { return *m_meshing; }
+    // ブロック変更による光の再伝播はtickごとにまとめて行う（新規チャンクはLightNewChunksで初期化すること）
+    LightEngine& GetLightEngine() { return m_light; }
+    // 生成済みのチャンクメッシュ（未生成ならnullptr、面の無いチャンクは空のメッシュ）
+    // levelが1以上の場合、coordはそのLODレベルの領域座標
+    const ChunkMesh* FindChunkMesh(const ChunkCoord& coord, int level = 0) const;
+    // ワールド読み込み（streamWorld無効時はnullptr）
+    const ChunkStreamer* GetChunkStreamer() const { return m_streamer.get(); }
+    // 起動開始から最初のフレーム（内側の範囲のメッシュ化後）を描画するまでの秒数（未描画なら無し）
+    std::optional<double> GetTimeToFirstFrame() const { return m_time_to_first_frame; }
+    // 起動開始から読み込み範囲の全チャンクがメッシュ化されるまでの秒数（未完了なら無し）
+    std::optional<double> GetTimeToFullViewDistance() const { return m_time_to_full_view; }
+    
+    // ブロックを変更し、変更ブロックを含むチャンクと、面・AOが変わり得る隣接チャンク（辺・角で接するものを含む）のメッシュを更新する
+    // メッシュ生成済みのチャンクは影響するスライスのみをその場で作り直し、未生成なら非同期生成を要求する
+    // 光量の変化は記録のみ行い、次のtickでまとめて伝播する
+    // 値が変化した場合にtrueを返す（未ロードのチャンクへの変更は無視）
+    bool SetBlock(int x, int y, int z, BlockId block);
+    BlockId GetBlock(int x, int y, int z) const { return m_chunks.GetBlock(x, y, z); }
+    // SetBlockでスライス単位の差し替えにより更新したチャンクメッシュ数（累計）
+    std::uint64_t GetIncrementalRemeshCount() const { return m_incremental_remeshes; }
+    // 描画スレッド（threadedRendering無効時はnullptr）
+    const RenderThread* GetRenderThread() const { return m_render_thread.get(); }
+    const FrameTimeRecorder& GetFrameTimeRecorder() const { return m_frame_times; }
+    // 入力イベント発生からシミュレーションtickで処理されるまでの遅延
+    const LatencyHistogram& GetInputLatencyHistogram() const { return m_input_latency; }
+    // 直近のtickで処理した入力イベント
+    std::span<const InputEvent> GetTickInput() const { return m_tick_input; }
+    std::uint64_t GetProcessedInputEventCount() const { return m_processed_input_events; }
+    // 直近のtickで読んだフレームバッファサイズ（次の描画でビューポートに設定される）
+    int GetViewportWidth() const { return m_viewport_width; }
+    int GetViewportHeight() const { return m_viewport_height; }
 
 private:
-    std::unique_ptr<Window> m_window;
+    StartupTrace m_startup_trace;  // 最初に生成して起動開始時刻とする
+    ApplicationConfig m_config;
+    std::unique_ptr<IWindow> m_window;
+    std::unique_ptr<JobSystem> m_job_system;
+    std::unique_ptr<FrameAllocator> m_frame_allocator;
+    std::unique_ptr<MeshingPipeline> m_meshing;
+    ChunkManager m_chunks;
+    LightEngine m_light{m_chunks};
+    std::unique_ptr<TerrainGenerator> m_terrain;
+    std::unique_ptr<ChunkStreamer> m_streamer;
+    std::vector<ChunkCoord> m_streamed_chunks;   // 回収用バッファ（毎フレーム再利用）
+    std::vector<ChunkCoord> m_meshable_chunks;
+    std::optional<double> m_time_to_first_frame;
+    std::optional<double> m_time_to_full_view;
+    // LODレベルごとの 詰めたチャンク（領域）座標 → メッシュ
+    std::array<std::unordered_map<std::uint64_t, ChunkMesh>, kLodLevelCount> m_chunk_meshes;
+    std::vector<CompletedChunkMesh> m_completed_meshes;           // 回収用バッファ（毎フレーム再利用）
+    GreedyMesher m_edit_mesher;                                   // ブロック変更時の差し替え用（メインスレッド）
+    std::uint64_t m_incremental_remeshes = 0;
+    std::unique_ptr<RenderThread> m_render_thread;
+    RenderCommandList m_render_commands;   // 直列描画時に使い回すコマンドリスト
+    FixedTimestep m_timestep;
+    FrameTimeRecorder m_frame_times;
+    LatencyHistogram m_input_latency;      // イベント数によらず固定サイズ
+    std::vector<InputEvent> m_tick_input;  // InputEventQueue容量分を事前確保
+    std::uint64_t m_processed_input_events = 0;
+    std::uint64_t m_frame_count = 0;
+    
+    // フレームバッファサイズはtickで最新値を読み、変わっていれば描画時にビューポートへ反映する
+    int m_viewport_width = 0;
+    int m_viewport_height = 0;
+    bool m_viewport_dirty = false;
     
     void InitializeLogging();
+    void InitializeJobSystem();
     void InitializeWindow();
-    void MainLoop();
-    void Render();
+    void InitializeRenderer();
+    void InitializeWorld();
+    // 起動タスクの最初の失敗（ワーカーから記録される）
+    struct StartupFailure {
+        std::mutex mutex;
+        bool failed = false;
+        std::string task;
+        std::string reason;
+    };
+    void ScheduleStartupTasks(JobCounter& counter, StartupFailure& failure);
+    void MainLoop(std::uint64_t maxFrames);
+    void LogFrameStatistics() const;
+    void ProcessInput();
+    // 最初のフレームを描画できるまで（内側の範囲のメッシュ化完了まで）読み込みを進める
+    void LoadFirstFrameArea();
+    // 生成済みチャンクの登録・光の初期化・メッシュ生成の要求と、新規生成ジョブの投入（待機しない）
+    void UpdateStreaming();
+    // 完了したメッシュの回収と新規ジョブの投入（待機しない）
+    void UpdateMeshing();
+    // 最初のフレーム・全範囲の読み込み完了の時刻を記録する
+    void RecordStreamingMetrics();
+    // (x, y, z): coord基準の変更ブロックのローカル座標（隣接チャンクでは -1 / kChunkSize）
+    void RemeshForBlockEdit(const ChunkCoord& coord, int x, int y, int z);
+    void Update(double deltaSeconds);
+    // 描画コマンドを記録して描画スレッドへ提出（直列描画時はその場で実行・提示）
+    // alpha: 直前tickと次tickの間の補間係数 [0, 1)
+    void Render(float alpha);
+    void RecordRenderCommands(RenderCommandList& commands);
 };
 
 } // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace BoxelGame {
+
+// 固定タイムステップのアキュムレータ
+// 可変長のフレーム時間を積算し、一定間隔のシミュレーションtick数と描画補間係数に変換する
+class FixedTimestep {
+public:
+    // tickRate: 1秒あたりのtick数、maxTicksPerFrame: 1フレームで消化する最大tick数（死のスパイラル防止）
+    explicit FixedTimestep(double tickRate = 60.0, int maxTicksPerFrame = 5);
+
+    // フレーム経過時間を積算し、このフレームで実行すべきtick数を返す
+    int Advance(double frameSeconds);
+
+    // 1tickの長さ（秒）
+    double GetTickDelta() const { return m_tick_delta; }
+    // 直前tickから次tickまでの補間係数 [0, 1)
+    float GetAlpha() const;
+
+    std::uint64_t GetTickCount() const { return m_tick_count; }
+    // 上限超過により破棄したtick数（負荷が継続的に高いことを示す）
+    std::uint64_t GetDroppedTickCount() const { return m_dropped_ticks; }
+
+private:
+    double m_tick_delta;
+    int m_max_ticks_per_frame;
+    double m_accumulator = 0.0;
+    std::uint64_t m_tick_count = 0;
+    std::uint64_t m_dropped_ticks = 0;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace BoxelGame {
+
+// 線形（バンプ）アロケータ
+// 確保はポインタを進めるだけで、個別の解放は行わずResetで一括解放する
+// std::pmr::memory_resourceとして振る舞うため、pmrコンテナのアロケータに渡せる
+// スレッドセーフではない（1スレッド専用）
+class LinearArena : public std::pmr::memory_resource {
+public:
+    explicit LinearArena(std::size_t capacity);
+    ~LinearArena() override;
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+    LinearArena(LinearArena&&) = delete;
+    LinearArena& operator=(LinearArena&&) = delete;
+
+    // 全確保を解放し、今回の使用量をピークへ反映
+    void Reset();
+
+    std::size_t GetCapacity() const { return m_capacity; }
+    // Reset以降の使用量（容量超過分を含む）
+    std::size_t GetUsedBytes() const { return m_offset + m_overflow_bytes; }
+    // 直前のResetまでの1フレームの使用量
+    std::size_t GetLastFrameBytes() const { return m_last_frame_bytes; }
+    // 全フレームでの最大使用量（容量見積もり用）
+    std::size_t GetHighWaterMark() const { return m_high_water_mark; }
+    // 容量を超えて上位アロケータへ退避した回数（累計）
+    std::uint64_t GetOverflowCount() const { return m_overflow_count; }
+
+private:
+    // 容量超過時の退避確保（Resetで解放）
+    struct OverflowBlock {
+        void* pointer;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+
+    std::byte* m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_offset = 0;
+    std::vector<OverflowBlock> m_overflow_blocks;
+    std::size_t m_overflow_bytes = 0;
+    std::size_t m_last_frame_bytes = 0;
+    std::size_t m_high_water_mark = 0;
+    std::uint64_t m_overflow_count = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+// スレッドごとの1フレーム用アロケータ
+// スレッド番号（JobSystem::GetCurrentThreadIndex、0はメインスレッド）ごとにLinearArenaを持ち、
+// フレーム境界でResetAllして一括解放する
+// ワーカーのアリーナはParallelFor（完了まで待機する同期的な並列処理）の中でのみ渡す
+// チャンク生成・メッシュ生成のようにフレームをまたぐジョブは、実行中にResetAllされ得るため使用しないこと
+class FrameAllocator {
+public:
+    FrameAllocator(unsigned threadCount, std::size_t bytesPerThread);
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    LinearArena& GetArena(unsigned threadIndex) { return *m_arenas[threadIndex]; }
+    const LinearArena& GetArena(unsigned threadIndex) const { return *m_arenas[threadIndex]; }
+    unsigned GetThreadCount() const { return static_cast<unsigned>(m_arenas.size()); }
+
+    // [0, count) をjobs.ParallelForで並列実行し、bodyへ実行スレッドのアリーナを渡す（完了まで待機）
+    // 確保したメモリは次のResetAllまで有効
+    void ParallelFor(JobSystem& jobs, std::size_t count, std::size_t grainSize,
+                     const std::function<void(std::size_t begin, std::size_t end, LinearArena& arena)>& body);
+
+    // 全スレッドのアリーナをResetし、フレームのピーク使用量を記録
+    // ParallelFor実行中に呼ばれた場合はBoxelGameException
+    void ResetAll();
+
+    // 直前フレームの全スレッド合計使用量
+    std::size_t GetLastFrameBytes() const { return m_last_frame_bytes; }
+    // 全フレームでの全スレッド合計使用量の最大
+    std::size_t GetHighWaterMark() const { return m_high_water_mark; }
+    std::uint64_t GetFrameCount() const { return m_frame_count; }
+
+    // スレッドごとのピーク使用量をログ出力
+    void LogStatistics() const;
+
+private:
+    std::vector<std::unique_ptr<LinearArena>> m_arenas;
+    std::atomic<int> m_active_parallel{0};  // 実行中のParallelFor数
+    std::size_t m_last_frame_bytes = 0;
+    std::size_t m_high_water_mark = 0;
+    std::uint64_t m_frame_count = 0;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
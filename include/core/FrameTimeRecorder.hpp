@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BoxelGame {
+
+// フレーム時間の統計値（時間はミリ秒）
+struct FrameTimeStatistics {
+    std::size_t sampleCount = 0;
+    double minMs = 0.0;
+    double averageMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double averageFps = 0.0;
+    double onePercentLowFps = 0.0;  // 最も遅い1%のフレームの平均FPS
+};
+
+// フレーム時間の記録と統計計算
+// 記録はメインループ内で呼ばれるため、構築時に確保した固定長のリングバッファへ書き込むだけとし、
+// 容量を超えた分は古いフレームから上書きする（統計は直近capacityフレームが対象）
+class FrameTimeRecorder {
+public:
+    explicit FrameTimeRecorder(std::size_t capacity = 1 << 16);
+
+    void Record(double frameSeconds);
+    void Reset();
+
+    // 統計の対象となる保持中のフレーム数（capacity以下）
+    std::size_t GetSampleCount() const { return m_count; }
+    std::size_t GetCapacity() const { return m_samples.size(); }
+    // Reset以降に記録した全フレーム数
+    std::uint64_t GetRecordedCount() const { return m_recorded; }
+    FrameTimeStatistics ComputeStatistics() const;
+
+private:
+    std::vector<double> m_samples;  // ミリ秒（リングバッファ）
+    std::size_t m_next = 0;         // 次に書き込む位置
+    std::size_t m_count = 0;
+    std::uint64_t m_recorded = 0;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
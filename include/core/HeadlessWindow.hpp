@@ -0,0 +1,49 @@
+#pragma once
+
+#include "core/IWindow.hpp"
+#include <cstdint>
+#include <string>
+
+namespace BoxelGame {
+
+// ディスプレイ・GLコンテキストを持たないオフスクリーンウィンドウ
+// GPUの無いビルドマシンでメインループを駆動するベンチマーク・テスト用
+class HeadlessWindow : public IWindow {
+public:
+    HeadlessWindow(int width = 1280, int height = 720, const std::string& title = "BoxelGame - Headless");
+    ~HeadlessWindow() override = default;
+
+    // IWindow インターフェース実装
+    bool ShouldClose() const override { return m_should_close; }
+    void SwapBuffers() override { ++m_frame_count; }
+    void PollEvents() override {}
+    void GetFramebufferSize(int& width, int& height) const override;
+
+    int GetWidth() const override { return m_width; }
+    int GetHeight() const override { return m_height; }
+    const std::string& GetTitle() const override { return m_title; }
+    bool HasGraphicsContext() const override { return false; }
+    void MakeContextCurrent() override {}
+    void DetachContext() override {}
+    void SetPresentMode(PresentMode mode) override { m_present_mode = mode; }
+    PresentMode GetPresentMode() const override { return m_present_mode; }
+    InputEventQueue& GetInputEvents() override { return m_input_events; }
+
+    // 次のShouldClose()でtrueを返すよう要求
+    void RequestClose() { m_should_close = true; }
+
+    // 提示（SwapBuffers）されたフレーム数
+    std::uint64_t GetPresentedFrameCount() const { return m_frame_count; }
+
+private:
+    int m_width;
+    int m_height;
+    std::string m_title;
+
+    bool m_should_close = false;
+    PresentMode m_present_mode = PresentMode::VSync;
+    InputEventQueue m_input_events;
+    std::uint64_t m_frame_count = 0;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
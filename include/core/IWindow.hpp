@@ -1,9 +1,26 @@
 #pragma once
 
+#include "core/InputEvent.hpp"
 #include <string>
 
 namespace BoxelGame {
 
+// バッファ提示モード（スワップ間隔）
+enum class PresentMode {
+    VSync,      // 垂直同期（スワップ間隔 1）
+    Adaptive,   // 適応型垂直同期（スワップ間隔 -1、未対応環境ではVSync）
+    Immediate   // 同期無し（スワップ間隔 0、ベンチマーク用）
+};
+
+inline const char* GetPresentModeName(PresentMode mode) {
+    switch (mode) {
+        case PresentMode::VSync: return "VSync";
+        case PresentMode::Adaptive: return "Adaptive";
+        case PresentMode::Immediate: return "Immediate";
+    }
+    return "Unknown";
+}
+
 // Windowクラスのインターフェース
 class IWindow {
 public:
@@ -17,12 +34,27 @@ public:
     virtual void PollEvents() = 0;
     
     // ウィンドウ情報取得
+    // 最新のフレームバッファサイズ（サイズ変更は入力キューを経由せず、ここで最新値のみを取得する）
     virtual void GetFramebufferSize(int& width, int& height) const = 0;
     
     // ウィンドウ基本情報
     virtual int GetWidth() const = 0;
     virtual int GetHeight() const = 0;
     virtual const std::string& GetTitle() const = 0;
+
+    // OpenGLコンテキストを保持しているか（falseの場合はGL呼び出しを行わない）
+    virtual bool HasGraphicsContext() const = 0;
+
+    // GLコンテキストを呼び出しスレッドに結び付ける/解除する（描画スレッドへの所有権移譲用）
+    virtual void MakeContextCurrent() = 0;
+    virtual void DetachContext() = 0;
+
+    // 提示モード（実際に適用されたモードはGetPresentModeで取得）
+    virtual void SetPresentMode(PresentMode mode) = 0;
+    virtual PresentMode GetPresentMode() const = 0;
+
+    // PollEventsで生成された入力イベントのキュー（PollEventsを呼ぶスレッドが生産者、シミュレーションが消費者）
+    virtual InputEventQueue& GetInputEvents() = 0;
 };
 
 } // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "core/SpscRingBuffer.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace BoxelGame {
+
+enum class InputEventType : std::uint8_t {
+    Key,                // code: キー, scancode, action, mods
+    MouseButton,        // code: ボタン, action, mods
+    CursorMove,         // x, y: カーソル座標
+    Scroll              // x, y: スクロール量
+};
+
+// タイムスタンプ付き入力イベント（GLFWコールバックで生成し、シミュレーションtickで消費する）
+struct InputEvent {
+    InputEventType type = InputEventType::Key;
+    std::uint64_t timestampNs = 0;  // GetInputTimestamp()の値
+    int code = 0;
+    int scancode = 0;
+    int action = 0;
+    int mods = 0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+// 入力イベントのタイムスタンプ（steady_clock、ナノ秒）
+inline std::uint64_t GetInputTimestamp() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// ウィンドウ（イベントポーリング側）からシミュレーションへの入力キュー
+using InputEventQueue = SpscRingBuffer<InputEvent, 1024>;
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "core/WorkStealingDeque.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+
+using JobFunction = std::move_only_function<void()>;
+
+struct Job;
+
+// ジョブ完了カウンタ
+// Schedule時に加算、ジョブ完了時に減算され、0で関連ジョブ全完了を表す
+// 依存ジョブ（ScheduleAfter）は0になった時点で投入される
+class JobCounter {
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_value.load(std::memory_order_acquire) == 0; }
+    int GetValue() const { return m_value.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> m_value{0};
+    std::mutex m_mutex;
+    std::vector<Job*> m_continuations;  // m_mutexで保護
+};
+
+// ワークスティーリング型ジョブシステム
+// ワーカーごとにChase-Lev両端キューを持ち、空になったワーカーは他ワーカーから盗む
+// 生成スレッド（メインスレッド）はスレッド番号0としてWait中にジョブを実行して待ち時間を埋める
+class JobSystem {
+public:
+    // workerCount: ワーカースレッド数（0の場合はハードウェア並列数-1、最低1）
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    // ハードウェア並列数に基づく既定ワーカー数
+    static unsigned DefaultWorkerCount();
+
+    // ジョブを投入（counterは完了まで生存していること）
+    void Schedule(JobFunction function, JobCounter* counter = nullptr);
+    // dependencyが0になってからジョブを投入
+    void ScheduleAfter(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+    // counterが0になるまで、ジョブを実行しながら待機
+    void Wait(JobCounter& counter);
+    // 取得できるジョブがあれば呼び出しスレッドで1つ実行する（実行した場合にtrue）
+    // カウンタで表せない条件を待つ間もワーカーの仕事を肩代わりするために使う
+    bool RunPendingJob();
+
+    // [0, count) をgrainSize単位のジョブに分割して並列実行し、完了まで待機
+    void ParallelFor(std::size_t count, std::size_t grainSize,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    unsigned GetWorkerCount() const { return static_cast<unsigned>(m_workers.size()); }
+    // ワーカー数 + メインスレッド
+    unsigned GetThreadCount() const { return GetWorkerCount() + 1; }
+    // 呼び出しスレッドの番号（0: メインスレッド、1..N: ワーカー、-1: このJobSystem外のスレッド）
+    int GetCurrentThreadIndex() const;
+
+private:
+    std::vector<std::unique_ptr<WorkStealingDeque<Job>>> m_queues;  // [0]はメインスレッド
+    std::vector<std::thread> m_workers;
+
+    // ワーカー以外のスレッドから投入されたジョブ
+    std::mutex m_injection_mutex;
+    std::deque<Job*> m_injection_queue;
+
+    // 休眠制御
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_wake;
+    std::atomic<int> m_pending{0};   // キュー投入済み・未取得のジョブ数
+    std::atomic<int> m_sleeping{0};
+    std::atomic<bool> m_stopping{false};
+
+    void WorkerLoop(unsigned threadIndex);
+    void Enqueue(Job* job);
+    Job* TryGetJob(int threadIndex);
+    void Execute(Job* job);
+    void Finish(JobCounter* counter);
+    void WakeWorkers(int count);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
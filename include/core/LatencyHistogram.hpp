@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace BoxelGame {
+
+// 遅延の統計値（時間はミリ秒）
+struct LatencyStatistics {
+    std::uint64_t sampleCount = 0;
+    double minMs = 0.0;
+    double averageMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+// 固定幅の区間に数えるだけの遅延ヒストグラム
+// 入力イベントごとに記録されるため、件数によらず確保・増加の無い固定サイズの配列に数える
+// パーセンタイルは区間の上端（kBucketWidthMs単位、範囲外はmaxMs）で近似し、min/max/平均は正確な値
+class LatencyHistogram {
+public:
+    static constexpr double kBucketWidthMs = 0.1;
+    static constexpr std::size_t kBucketCount = 1024;  // 0〜102.4ms、それ以上は最後の区間
+
+    void Record(double latencySeconds);
+    void Reset();
+
+    std::uint64_t GetSampleCount() const { return m_count; }
+    LatencyStatistics ComputeStatistics() const;
+
+private:
+    std::array<std::uint64_t, kBucketCount> m_buckets{};
+    std::uint64_t m_count = 0;
+    double m_total_ms = 0.0;
+    double m_min_ms = 0.0;
+    double m_max_ms = 0.0;
+
+    double Percentile(double percentile) const;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+// コンパイル時ログレベルフィルタ
+// SPDLOG_ACTIVE_LEVEL（CMakeでビルド構成ごとに設定）未満のBOXEL_LOG_*は書式引数の評価も含めて除去される
+// 有効なレベルでも実行時レベルを先に確認し、無効なら引数を評価しない
+#ifndef SPDLOG_ACTIVE_LEVEL
+    #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#endif
+
+#include <spdlog/spdlog.h>
+
+#define BOXEL_LOG_AT(level, ...)                                                                        \
+    do {                                                                                                \
+        auto* boxelLogger = ::spdlog::default_logger_raw();                                             \
+        if (boxelLogger->should_log(level)) {                                                           \
+            boxelLogger->log(::spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__); \
+        }                                                                                               \
+    } while (0)
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+    #define BOXEL_LOG_TRACE(...) BOXEL_LOG_AT(::spdlog::level::trace, __VA_ARGS__)
+#else
+    #define BOXEL_LOG_TRACE(...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define BOXEL_LOG_DEBUG(...) BOXEL_LOG_AT(::spdlog::level::debug, __VA_ARGS__)
+#else
+    #define BOXEL_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+    #define BOXEL_LOG_INFO(...) BOXEL_LOG_AT(::spdlog::level::info, __VA_ARGS__)
+#else
+    #define BOXEL_LOG_INFO(...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+    #define BOXEL_LOG_WARN(...) BOXEL_LOG_AT(::spdlog::level::warn, __VA_ARGS__)
+#else
+    #define BOXEL_LOG_WARN(...) ((void)0)
+#endif
+
+#define BOXEL_LOG_ERROR(...) BOXEL_LOG_AT(::spdlog::level::err, __VA_ARGS__)
\ No newline at end of file
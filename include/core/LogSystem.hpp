@@ -0,0 +1,40 @@
+#pragma once
+
+#include <spdlog/common.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace BoxelGame {
+
+// 非同期ログのキュー満杯時の挙動
+enum class LogOverflowPolicy {
+    DropNewest,  // 新しいメッセージを破棄して呼び出し側をブロックしない（既定、フレームを止めない）
+    Block        // 空きができるまで呼び出し側が待機（ログの欠落を許容しない場合）
+};
+
+struct LoggingConfig {
+    bool async = true;                                    // falseの場合は同期出力
+    std::size_t queueCapacity = 8192;                     // 非同期キュー容量（2のべき乗）
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::DropNewest;
+    spdlog::level::level_enum level = spdlog::level::info; // 実行時ログレベル
+};
+
+// ログバックエンド
+// 非同期モードでは呼び出しスレッドで書式化したメッセージを固定長レコードとして
+// ロックフリーキューへ積み、専用の書き込みスレッドがコンソールへ出力する
+class LogSystem {
+public:
+    LogSystem() = delete;
+
+    // 既定ロガーを差し替える（初期化済みの場合は先にShutdownする）
+    // 非同期キュー容量が2以上の2のべき乗でない場合はInitializationException
+    static void Initialize(const LoggingConfig& config);
+    // キューを出力し切って書き込みスレッドを停止し、同期ロガーへ戻す
+    static void Shutdown();
+
+    static bool IsAsync();
+    // キュー満杯により破棄されたメッセージ数
+    static std::uint64_t GetDroppedMessageCount();
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace BoxelGame {
+
+// 固定容量のロックフリーMPMCキュー（Dmitry Vyukov の bounded MPMC queue）
+// 各セルのシーケンス番号で所有権を受け渡すため、投入・取得ともにCAS1回で完了し動的確保を行わない
+template <typename T>
+class MpmcQueue {
+public:
+    // capacityは2のべき乗
+    explicit MpmcQueue(std::size_t capacity)
+        : m_mask(capacity - 1), m_cells(std::make_unique<Cell[]>(capacity)) {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // 満杯の場合はfalse（valueは変更されない）
+    template <typename U>
+    bool TryPush(U&& value) {
+        Cell* cell = nullptr;
+        std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = m_enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 空の場合はfalse
+    bool TryPop(T& value) {
+        Cell* cell = nullptr;
+        std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_cells[position & m_mask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (difference == 0) {
+                if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = m_dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t GetCapacity() const { return m_mask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(64) std::atomic<std::size_t> m_enqueue_position{0};
+    alignas(64) std::atomic<std::size_t> m_dequeue_position{0};
+};
+
+} // namespace BoxelGame
\ No newline at end of file
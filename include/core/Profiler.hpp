@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// BOXEL_PROFILE_ENABLED はCMakeオプション BOXEL_ENABLE_PROFILER から設定される
+#ifndef BOXEL_PROFILE_ENABLED
+    #define BOXEL_PROFILE_ENABLED 0
+#endif
+
+namespace BoxelGame {
+
+// 階層型CPUフレームプロファイラ
+// 各スレッドは専用のリングバッファ（単一書き込み・ロックフリー）へゾーンを記録し、
+// 直近Nフレーム分をChrome Trace形式（chrome://tracing, Perfetto）でエクスポートできる
+class Profiler {
+public:
+    Profiler() = delete;
+
+    // 単調増加クロック（ナノ秒）
+    static std::uint64_t Now();
+
+    // フレーム境界を記録（メインスレッドから毎フレーム呼び出す）
+    static void MarkFrame();
+    static std::uint64_t GetFrameIndex();
+
+    // 呼び出しスレッドの表示名を設定（トレースのスレッド名になる）
+    static void SetThreadName(const std::string& name);
+
+    // ゾーンを呼び出しスレッドのバッファへ記録（nameは静的寿命の文字列であること）
+    static void RecordZone(const char* name, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth);
+    static std::uint32_t PushDepth();
+    static void PopDepth();
+
+    // 直近frameCountフレームのゾーンをChrome Trace JSONとして出力
+    static std::string ExportChromeTraceJson(std::uint32_t frameCount);
+    static bool ExportChromeTrace(const std::string& path, std::uint32_t frameCount);
+
+    // 全スレッドの記録を破棄（テスト用）
+    static void Reset();
+};
+
+// スコープの開始から終了までを1ゾーンとして記録するRAIIヘルパー
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : m_name(name), m_depth(Profiler::PushDepth()), m_start(Profiler::Now()) {}
+    ~ProfileScope() {
+        Profiler::RecordZone(m_name, m_start, Profiler::Now(), m_depth);
+        Profiler::PopDepth();
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;
+    std::uint32_t m_depth;
+    std::uint64_t m_start;
+};
+
+} // namespace BoxelGame
+
+// プロファイリングマクロ（無効時は引数も含めて完全に除去される）
+#if BOXEL_PROFILE_ENABLED
+    #define BOXEL_PROFILE_CONCAT_INNER(a, b) a##b
+    #define BOXEL_PROFILE_CONCAT(a, b) BOXEL_PROFILE_CONCAT_INNER(a, b)
+    #define BOXEL_PROFILE_SCOPE(name) \
+        ::BoxelGame::ProfileScope BOXEL_PROFILE_CONCAT(boxelProfileScope_, __LINE__)(name)
+    #define BOXEL_PROFILE_FUNCTION() BOXEL_PROFILE_SCOPE(__func__)
+    #define BOXEL_PROFILE_FRAME() ::BoxelGame::Profiler::MarkFrame()
+    #define BOXEL_PROFILE_THREAD(name) ::BoxelGame::Profiler::SetThreadName(name)
+#else
+    #define BOXEL_PROFILE_SCOPE(name) ((void)0)
+    #define BOXEL_PROFILE_FUNCTION() ((void)0)
+    #define BOXEL_PROFILE_FRAME() ((void)0)
+    #define BOXEL_PROFILE_THREAD(name) ((void)0)
+#endif
\ No newline at end of file
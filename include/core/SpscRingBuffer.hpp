@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace BoxelGame {
+
+// 固定容量の単一生産者・単一消費者リングバッファ（ロックフリー、動的確保なし）
+// 生産者はTryPushのみ、消費者はTryPopのみを呼び出すこと
+template <typename T, std::size_t Capacity>
+class SpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacityは2のべき乗である必要があります");
+
+public:
+    // 満杯の場合はfalse
+    bool TryPush(const T& value) {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_cached_tail == Capacity) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if (head - m_cached_tail == Capacity) {
+                return false;
+            }
+        }
+        m_items[head & (Capacity - 1)] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 空の場合はfalse
+    bool TryPop(T& value) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_cached_head) {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if (tail == m_cached_head) {
+                return false;
+            }
+        }
+        value = m_items[tail & (Capacity - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 概算の要素数（他方のスレッドと並行する場合は目安）
+    std::size_t ApproximateSize() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t GetCapacity() { return Capacity; }
+
+private:
+    std::array<T, Capacity> m_items{};
+    // 生産者側
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    std::size_t m_cached_tail = 0;
+    // 消費者側
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_cached_head = 0;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
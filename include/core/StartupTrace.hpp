@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+
+// 起動フェーズ1件の計測結果（時刻は計測開始からのミリ秒）
+struct StartupPhaseRecord {
+    std::string name;
+    double startMs = 0.0;
+    double durationMs = 0.0;
+    bool onMainThread = true;  // falseの場合はジョブワーカーで並列実行されたフェーズ
+};
+
+// 起動フェーズの所要時間を記録する（複数スレッドから記録可能）
+// 計測開始は生成時点、計測終了はFinishの呼び出し時点
+class StartupTrace {
+public:
+    StartupTrace();
+
+    StartupTrace(const StartupTrace&) = delete;
+    StartupTrace& operator=(const StartupTrace&) = delete;
+
+    // スコープの開始から終了までを1フェーズとして記録するRAIIヘルパー
+    class Phase {
+    public:
+        Phase(StartupTrace* trace, std::string name);
+        ~Phase();
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+    private:
+        StartupTrace* m_trace;
+        std::string m_name;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    // 起動完了を記録（以降のGetTotalSecondsは固定値）
+    void Finish();
+    bool IsFinished() const;
+    double GetTotalSeconds() const;
+    // 計測開始からの経過秒数（Finish後も進む。起動後のロード指標の計測に使う）
+    double GetElapsedSeconds() const;
+
+    // 開始時刻順のフェーズ一覧
+    std::vector<StartupPhaseRecord> GetPhases() const;
+
+    // フェーズ別の所要時間と、予算（秒）に対する合計をログ出力
+    void LogReport(double budgetSeconds) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point m_origin;
+    const std::thread::id m_main_thread;
+    mutable std::mutex m_mutex;
+    std::vector<StartupPhaseRecord> m_phases;  // m_mutexで保護
+    Clock::time_point m_finish;                // m_mutexで保護
+    bool m_finished = false;                   // m_mutexで保護
+
+    void Record(std::string name, Clock::time_point start, Clock::time_point end);
+    double ToMilliseconds(Clock::time_point time) const;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -12,6 +12,9 @@
 
 #include "core/Exception.hpp"
 #include "core/IWindow.hpp"
+#include "core/StartupTrace.hpp"
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 struct GLFWwindow;
@@ -27,7 +30,9 @@ public:
 
 class Window : public IWindow {
 public:
-    Window(int width = 1920, int height = 1080, const std::string& title = "BoxelGame");
+    // startupTraceを指定するとGLFW・ウィンドウ・GLADの各初期化フェーズを記録する
+    Window(int width = 1920, int height = 1080, const std::string& title = "BoxelGame",
+           StartupTrace* startupTrace = nullptr);
     ~Window();
 
     // コピー・ムーブ操作を削除（RAII/一意所有権）
@@ -46,21 +51,39 @@ public:
     int GetWidth() const override { return m_width; }
     int GetHeight() const override { return m_height; }
     const std::string& GetTitle() const override { return m_title; }
+    bool HasGraphicsContext() const override { return m_window != nullptr; }
+    void MakeContextCurrent() override;
+    void DetachContext() override;
+    void SetPresentMode(PresentMode mode) override;
+    PresentMode GetPresentMode() const override { return m_present_mode; }
+    InputEventQueue& GetInputEvents() override { return m_input_events; }
 
 private:
     GLFWwindow* m_window;
     int m_width;
     int m_height;
     std::string m_title;
+    PresentMode m_present_mode = PresentMode::VSync;
+    InputEventQueue m_input_events;
+    std::uint64_t m_dropped_input_events = 0;
+    // 最新のフレームバッファサイズ（幅<<32 | 高さ）
+    // 変更は連続して大量に届くため入力キューを経由せず上書きし、キューの溢れで失われないようにする
+    std::atomic<std::uint64_t> m_framebuffer_size{0};
 
     void InitializeGLFW();
     void InitializeWindow();
     void InitializeOpenGL();
     void SetupCallbacks();
+    void PushInputEvent(const InputEvent& event);
+    void StoreFramebufferSize(int width, int height);
 
     // GLFWコールバック関数
     static void ErrorCallback(int error, const char* description);
     static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
+    static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void CursorPosCallback(GLFWwindow* window, double x, double y);
+    static void ScrollCallback(GLFWwindow* window, double xOffset, double yOffset);
 };
 
 } // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace BoxelGame {
+
+// Chase-Lev ワークスティーリング両端キュー（固定容量）
+// 所有スレッドのみがPush/Popで底側を操作し、他スレッドはStealで天井側から取得する
+// 実装は Lê et al. "Correct and Efficient Work-Stealing for Weak Memory Models" (2013) に準拠
+template <typename T>
+class WorkStealingDeque {
+public:
+    // capacityは2のべき乗
+    explicit WorkStealingDeque(std::size_t capacity = 4096)
+        : m_mask(static_cast<std::int64_t>(capacity) - 1),
+          m_buffer(std::make_unique<std::atomic<T*>[]>(capacity)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 所有スレッドのみ: 満杯の場合はfalse
+    bool Push(T* item) {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > m_mask) {
+            return false;
+        }
+        m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // 所有スレッドのみ: 最後にPushした要素を取得（空の場合はnullptr）
+    T* Pop() {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // 最後の1要素はStealと競合するためCASで確定する
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // 任意スレッド: 最も古い要素を取得（空または競合に負けた場合はnullptr）
+    T* Steal() {
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T* item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // 概算の要素数（他スレッドの操作と並行する場合は目安）
+    std::size_t ApproximateSize() const {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> m_top{0};
+    alignas(64) std::atomic<std::int64_t> m_bottom{0};
+    std::int64_t m_mask;
+    std::unique_ptr<std::atomic<T*>[]> m_buffer;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
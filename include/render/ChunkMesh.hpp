@@ -0,0 +1,178 @@
+#pragma once
+
+#include "render/VoxelVertex.hpp"
+#include "world/Block.hpp"
+#include "world/Chunk.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace BoxelGame {
+
+// 面内の2軸（u: 幅方向, v: 高さ方向）
+// X面: u=Z, v=Y / Y面: u=X, v=Z / Z面: u=X, v=Y
+constexpr int GetFaceUAxis(BlockFace face) {
+    return GetFaceAxis(face) == 0 ? 2 : 0;
+}
+
+constexpr int GetFaceVAxis(BlockFace face) {
+    return GetFaceAxis(face) == 1 ? 2 : 1;
+}
+
+// 面の角ごとのAO（0: 最も暗い .. 3: 遮蔽無し）を2ビットずつ詰めた値での位置
+// (cornerU, cornerV) は面内のu/v方向の角（0: 最小側, 1: 最大側）
+constexpr int GetAmbientOcclusionShift(int cornerU, int cornerV) {
+    return (cornerU + cornerV * 2) * 2;
+}
+
+constexpr std::uint32_t GetCornerAmbientOcclusion(std::uint8_t packed, int cornerU, int cornerV) {
+    return (packed >> GetAmbientOcclusionShift(cornerU, cornerV)) & 0x3u;
+}
+
+// 全ての角が遮蔽無し
+constexpr std::uint8_t kNoAmbientOcclusion = 0xFF;
+
+// 同一ブロック種別・同一AOの面を矩形に統合した四角形
+// (x, y, z) は四角形に含まれる最小座標のブロック（チャンクローカル）
+struct MeshQuad {
+    std::uint8_t x = 0;
+    std::uint8_t y = 0;
+    std::uint8_t z = 0;
+    std::uint8_t width = 1;   // u方向のブロック数
+    std::uint8_t height = 1;  // v方向のブロック数
+    BlockFace face = BlockFace::PositiveX;
+    std::uint16_t textureLayer = 0;
+    std::uint8_t ambientOcclusion = kNoAmbientOcclusion;  // 角ごとのAO（GetCornerAmbientOcclusion）
+
+    friend bool operator==(const MeshQuad&, const MeshQuad&) = default;
+};
+
+// 四角形を4頂点へ展開して追加する
+// 頂点は面の外側から見て反時計回りに並び、通常は四角形の最小角（角(0, 0)）から始まる
+// 三角形は共通のインデックス 0,1,2 / 0,2,3 で頂点0と2を結ぶ対角線で分割されるため、
+// 対角線の両端のAOの和が他方より小さい場合は開始頂点を1つずらして対角線を入れ替え、
+// 暗い角の補間が四角形の半分へ伸びる異方性を防ぐ
+inline void AppendQuadVertices(const MeshQuad& quad, std::vector<PackedVoxelVertex>& out) {
+    const int axis = GetFaceAxis(quad.face);
+    const int uAxis = GetFaceUAxis(quad.face);
+    const int vAxis = GetFaceVAxis(quad.face);
+    const bool positive = IsPositiveFace(quad.face);
+    
+    // (u, v)軸の外積が法線と逆向きになる面（+X, +Y, -Z）は角の巡回順を逆にする
+    static constexpr std::uint32_t kCounterClockwise[kVerticesPerQuad][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    static constexpr std::uint32_t kClockwise[kVerticesPerQuad][2] = {{0, 0}, {0, 1}, {1, 1}, {1, 0}};
+    const bool reversed = positive != (axis == 2);
+    const auto& corners = reversed ? kClockwise : kCounterClockwise;
+    
+    std::uint32_t ao[kVerticesPerQuad];
+    for (int i = 0; i < kVerticesPerQuad; ++i) {
+        ao[i] = GetCornerAmbientOcclusion(quad.ambientOcclusion, static_cast<int>(corners[i][0]),
+                                          static_cast<int>(corners[i][1]));
+    }
+    const int first = ao[0] + ao[2] < ao[1] + ao[3] ? 1 : 0;
+    
+    std::uint32_t base[3] = {quad.x, quad.y, quad.z};
+    base[axis] += positive ? 1 : 0;
+    for (int i = 0; i < kVerticesPerQuad; ++i) {
+        const int index = (first + i) % kVerticesPerQuad;
+        const auto& corner = corners[index];
+        std::uint32_t position[3] = {base[0], base[1], base[2]};
+        position[uAxis] += corner[0] * quad.width;
+        position[vAxis] += corner[1] * quad.height;
+        out.push_back(PackedVoxelVertex::Pack(position[0], position[1], position[2],
+                                              static_cast<std::uint32_t>(quad.face), ao[index],
+                                              corner[0], corner[1], quad.width, quad.height, quad.textureLayer));
+    }
+}
+
+// 四角形の4頂点（開始頂点はどれでもよい）から元の四角形を復元する
+inline MeshQuad DecodeQuad(std::span<const PackedVoxelVertex> quadVertices) {
+    const PackedVoxelVertex& vertex = quadVertices[0];
+    MeshQuad quad;
+    quad.face = static_cast<BlockFace>(vertex.GetNormal());
+    quad.width = static_cast<std::uint8_t>(vertex.GetWidth());
+    quad.height = static_cast<std::uint8_t>(vertex.GetHeight());
+    quad.textureLayer = static_cast<std::uint16_t>(vertex.GetTextureLayer());
+    quad.ambientOcclusion = 0;
+    for (const PackedVoxelVertex& corner : quadVertices.first(kVerticesPerQuad)) {
+        quad.ambientOcclusion |= static_cast<std::uint8_t>(
+            corner.GetAmbientOcclusion() << GetAmbientOcclusionShift(static_cast<int>(corner.GetCornerU()),
+                                                                     static_cast<int>(corner.GetCornerV())));
+    }
+    
+    std::uint32_t position[3] = {vertex.GetX(), vertex.GetY(), vertex.GetZ()};
+    position[GetFaceUAxis(quad.face)] -= vertex.GetCornerU() * quad.width;
+    position[GetFaceVAxis(quad.face)] -= vertex.GetCornerV() * quad.height;
+    position[GetFaceAxis(quad.face)] -= IsPositiveFace(quad.face) ? 1 : 0;
+    quad.x = static_cast<std::uint8_t>(position[0]);
+    quad.y = static_cast<std::uint8_t>(position[1]);
+    quad.z = static_cast<std::uint8_t>(position[2]);
+    return quad;
+}
+
+// 1チャンク分のメッシュ生成結果（GPUへそのまま転送できる圧縮頂点列）
+// 四角形（4頂点）は面・スライス（法線軸方向の座標）順に並び、スライス単位で差し替えられる
+struct ChunkMesh {
+    static constexpr int kSliceCount = kBlockFaceCount * kChunkSize;
+
+    std::vector<PackedVoxelVertex> vertices;
+    // 面×スライスごとの頂点の開始位置（[kSliceCount]は終端）
+    std::array<std::uint32_t, kSliceCount + 1> sliceOffsets{};
+
+    static constexpr int SliceIndex(BlockFace face, int slice) {
+        return static_cast<int>(face) * kChunkSize + slice;
+    }
+
+    void Clear() {
+        vertices.clear();
+        sliceOffsets.fill(0);
+    }
+    void AddQuad(const MeshQuad& quad) {
+        AppendQuadVertices(quad, vertices);
+    }
+    // メッシャーが面・スライスの四角形を出力し終えた時点で呼び、次のスライスの開始位置を記録する
+    void EndSlice(BlockFace face, int slice) {
+        sliceOffsets[SliceIndex(face, slice) + 1] = static_cast<std::uint32_t>(vertices.size());
+    }
+    std::span<const PackedVoxelVertex> GetSlice(BlockFace face, int slice) const {
+        const int index = SliceIndex(face, slice);
+        return std::span<const PackedVoxelVertex>(vertices).subspan(sliceOffsets[index], sliceOffsets[index + 1] - sliceOffsets[index]);
+    }
+    // 1スライス分の頂点を差し替え、以降の開始位置をずらす
+    void ReplaceSlice(BlockFace face, int slice, std::span<const PackedVoxelVertex> replacement) {
+        const int index = SliceIndex(face, slice);
+        const auto begin = vertices.begin() + sliceOffsets[index];
+        const auto end = vertices.begin() + sliceOffsets[index + 1];
+        const auto oldCount = static_cast<std::ptrdiff_t>(end - begin);
+        const auto newCount = static_cast<std::ptrdiff_t>(replacement.size());
+        
+        if (newCount <= oldCount) {
+            std::copy(replacement.begin(), replacement.end(), begin);
+            vertices.erase(begin + newCount, end);
+        } else {
+            std::copy(replacement.begin(), replacement.begin() + oldCount, begin);
+            vertices.insert(end, replacement.begin() + oldCount, replacement.end());
+        }
+        for (int i = index + 1; i <= kSliceCount; ++i) {
+            sliceOffsets[i] = static_cast<std::uint32_t>(static_cast<std::ptrdiff_t>(sliceOffsets[i]) + newCount - oldCount);
+        }
+    }
+    bool IsEmpty() const { return vertices.empty(); }
+    std::size_t GetQuadCount() const { return vertices.size() / kVerticesPerQuad; }
+    MeshQuad GetQuad(std::size_t index) const {
+        return DecodeQuad(std::span<const PackedVoxelVertex>(vertices).subspan(index * kVerticesPerQuad, kVerticesPerQuad));
+    }
+    // 統合前の面数（統合率の確認用）
+    std::size_t CountFaces() const {
+        std::size_t faces = 0;
+        for (std::size_t i = 0; i < vertices.size(); i += kVerticesPerQuad) {
+            faces += static_cast<std::size_t>(vertices[i].GetWidth()) * vertices[i].GetHeight();
+        }
+        return faces;
+    }
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "render/ChunkMesh.hpp"
+#include "world/PaddedChunk.hpp"
+#include "world/ChunkManager.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace BoxelGame {
+
+// ビットマスクによるGreedy Meshing
+// 境界込み18ブロックの列を1語（32ビット）の占有ビットマスクとし、
+// シフト・AND・NOTで可視面を求め、面ごとのスライス行マスクをビット走査して矩形へ統合する
+// 面を描画するのは立方体ブロック（IsCubeBlock）、面を隠すのは不透明な立方体（IsFaceOccludingBlock）で、
+// 列は両者を別々に持つ（ガラス・葉に接する面は描画する）
+// 頂点ごとのAOは面の空気側の層の遮蔽ビットから求め（角の3近傍規則）、種別とAOが一致する面のみ統合する
+// 四角形は圧縮頂点（PackedVoxelVertex）として直接ChunkMeshへ書き出し、
+// 出力はNaiveMesherと同一の頂点列（同じ順序）になる
+// 作業領域をメンバに持つため、インスタンスはスレッドごとに用意すること
+class GreedyMesher {
+public:
+    void Mesh(const PaddedChunk& chunk, ChunkMesh& out);
+
+    // 1ブロックの変更で面・AOが変わり得るスライスだけを近傍チャンクから作り直し、meshを差し替える
+    // (x, y, z) は変更されたブロックのmesh側チャンク基準ローカル座標（隣接チャンクの変更は -1 / kChunkSize）
+    // meshは変更前のブロック配置で生成済みであること。作り直したスライス数を返す
+    int RemeshAroundBlock(const ChunkNeighborhood& neighborhood, int x, int y, int z, ChunkMesh& mesh);
+
+private:
+    // 軸ごとの占有列: [軸][列] 、列は面内2軸の境界込み座標で18×18
+    std::array<std::array<std::uint32_t, kPaddedChunkSize * kPaddedChunkSize>, 3> m_columns{};
+    // 軸ごとの遮蔽列（面を隠すブロックのみ）: m_columnsと同じ配置
+    std::array<std::array<std::uint32_t, kPaddedChunkSize * kPaddedChunkSize>, 3> m_occluder_columns{};
+    // 可視面のスライス行マスク: [面][スライス][v行] のビットu
+    std::array<std::array<std::array<std::uint16_t, kChunkSize>, kChunkSize>, kBlockFaceCount> m_face_rows{};
+
+    void BuildColumns(const PaddedChunk& chunk);
+    void BuildFaceRows();
+    std::vector<PackedVoxelVertex> m_slice_vertices;  // RemeshAroundBlockの作業領域
+
+    void MergeFaces(const PaddedChunk& chunk, ChunkMesh& out);
+    void MeshSlice(const ChunkNeighborhood& neighborhood, BlockFace face, int slice, std::vector<PackedVoxelVertex>& out);
+};
+
+// 参照実装: ブロックごとに6近傍を調べ、スライスごとの2次元マスクから矩形を統合する
+// GreedyMesherの正しさ検証・性能比較用
+class NaiveMesher {
+public:
+    static void Mesh(const PaddedChunk& chunk, ChunkMesh& out);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "world/ChunkCoord.hpp"
+#include "world/ChunkLod.hpp"
+#include <array>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace BoxelGame {
+
+// 描画に使う領域とそのLODレベル
+struct LodNode {
+    ChunkCoord region;  // レベルlevelの領域座標（レベル0はチャンク座標）
+    int level = 0;
+
+    friend bool operator==(const LodNode&, const LodNode&) = default;
+};
+
+// 視点からの距離でLODレベルを選ぶ
+// 最も粗いレベルの領域から八分木として辿り、視点から領域の境界ボックス（AABB）の最近点までの距離が
+// 閾値を超える領域はそのレベルで描画し、それ以外は8つの子領域へ分割する。選ばれた領域は重ならず、範囲内を隙間なく覆う
+// 閾値の前後で毎フレーム切り替わらないよう、現在粗い領域は (閾値 - 幅) を下回るまで粗いまま、
+// 現在分割されている領域は (閾値 + 幅) を超えるまで分割したままとする（ヒステリシス）
+class LodSelector {
+public:
+    struct Config {
+        // レベル1へ切り替える距離（チャンク単位）。レベルLは level1Distance × 2^(L-1)
+        float level1Distance = 8.0f;
+        // 切り替え閾値の前後に設ける不感帯の幅（チャンク単位）
+        float hysteresis = 1.0f;
+        int maxLevel = kMaxLodLevel;
+    };
+
+    LodSelector();
+    explicit LodSelector(const Config& config);
+
+    // [minChunk, maxChunk] の範囲を覆う領域を選び、outへ設定する（視点はブロック座標）
+    void Select(float viewerX, float viewerY, float viewerZ,
+                const ChunkCoord& minChunk, const ChunkCoord& maxChunk, std::vector<LodNode>& out);
+
+    float GetSwitchDistance(int level) const;
+    const Config& GetConfig() const { return m_config; }
+    // 前回の選択から粗くした・分割した領域の累計（初めて辿った領域は含めない）
+    std::uint64_t GetSwitchCount() const { return m_switch_count; }
+
+private:
+    // レベルごとの前回の状態（詰めた領域座標）
+    struct LevelState {
+        std::unordered_set<std::uint64_t> coarse;  // そのレベルで描画した領域
+        std::unordered_set<std::uint64_t> split;   // 子領域へ分割した領域
+    };
+
+    Config m_config;
+    std::array<LevelState, kLodLevelCount> m_previous;
+    std::array<LevelState, kLodLevelCount> m_current;
+    std::uint64_t m_switch_count = 0;
+
+    void Visit(const ChunkCoord& region, int level, const float viewer[3],
+               const ChunkCoord& minChunk, const ChunkCoord& maxChunk, std::vector<LodNode>& out);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
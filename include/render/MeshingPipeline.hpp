@@ -0,0 +1,99 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "core/MpmcQueue.hpp"
+#include "render/ChunkMesh.hpp"
+#include "world/ChunkLod.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/PaddedChunk.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace BoxelGame {
+
+// 生成が完了し、最新の状態と一致することを確認済みのメッシュ
+// LODレベル1以上では coord はそのレベルの領域座標で、メッシュの座標は 2^level 倍して描画する
+struct CompletedChunkMesh {
+    ChunkCoord coord;
+    int lodLevel = 0;
+    ChunkMesh mesh;
+};
+
+// 非同期チャンクメッシュ生成
+// メインスレッドで要求されたチャンクを視点からの距離順に、境界込みのスナップショットとして
+// ジョブワーカーへ渡し、完了したメッシュをロックフリーの完了キュー経由で受け取る
+// Updateは待機しない（完了分の回収と空き枠分の投入のみ行う）
+// スナップショット後にチャンクが変更・アンロードされた場合や、同じチャンクが再要求された場合、
+// 古い結果は破棄される
+// LODレベル1以上の要求は、領域内のチャンクを縮小したスナップショット（BuildLodChunk）から同じメッシャーで生成する
+// Request/Update/破棄はメインスレッドから呼ぶこと
+class MeshingPipeline {
+public:
+    // maxJobsInFlight: 同時に実行中とするジョブ数の上限（スナップショットのメモリ量を制限する）
+    explicit MeshingPipeline(JobSystem& jobSystem, std::size_t maxJobsInFlight = 64);
+    // 実行中のジョブ完了を待つ
+    ~MeshingPipeline();
+
+    MeshingPipeline(const MeshingPipeline&) = delete;
+    MeshingPipeline& operator=(const MeshingPipeline&) = delete;
+
+    // チャンク（levelが1以上ならLOD領域）のメッシュ生成を要求（既に要求済み・実行中の場合は再生成を予約）
+    void Request(const ChunkCoord& coord, int level = 0);
+    // 未投入の要求を取り消す（アンロード時、実行中の結果は版の不一致で破棄される）
+    void Cancel(const ChunkCoord& coord, int level = 0);
+
+    // 優先度計算に使う視点位置（ブロック座標）
+    void SetViewerPosition(float x, float y, float z);
+
+    // 完了済みメッシュを回収してoutへ追加し、空き枠分の要求をスナップショットしてジョブを投入する
+    void Update(const ChunkManager& chunks, std::vector<CompletedChunkMesh>& out);
+
+    std::size_t GetPendingCount() const { return m_pending.size(); }
+    std::size_t GetJobsInFlight() const { return m_jobs_in_flight; }
+    std::uint64_t GetCompletedCount() const { return m_completed_count; }
+    // 変更・アンロード・再要求により破棄した結果の数
+    std::uint64_t GetDiscardedCount() const { return m_discarded_count; }
+
+private:
+    // ジョブ1件分のスナップショットと出力（使い回してメモリ確保を避ける）
+    struct MeshJob {
+        ChunkCoord coord;
+        int level = 0;
+        std::uint64_t ticket = 0;    // 要求の通し番号（同じチャンクの新しい要求で古い結果を見分ける）
+        std::uint64_t revision = 0;  // スナップショット時の版（ComputeLodRevision）
+        PaddedChunk snapshot;
+        ChunkMesh mesh;
+    };
+
+    struct PendingRequest {
+        ChunkCoord coord;
+        int level = 0;
+        std::uint64_t ticket = 0;
+    };
+
+    JobSystem& m_job_system;
+    JobCounter m_jobs;
+    MpmcQueue<MeshJob*> m_completed;
+    std::vector<std::unique_ptr<MeshJob>> m_job_storage;
+    std::vector<MeshJob*> m_free_jobs;
+
+    std::vector<PendingRequest> m_pending;
+    // LODレベルごとの 詰めた座標 → 最新の要求番号
+    std::array<std::unordered_map<std::uint64_t, std::uint64_t>, kLodLevelCount> m_latest_tickets;
+    std::uint64_t m_next_ticket = 1;
+    float m_viewer[3] = {0.0f, 0.0f, 0.0f};
+
+    std::size_t m_jobs_in_flight = 0;
+    std::uint64_t m_completed_count = 0;
+    std::uint64_t m_discarded_count = 0;
+
+    void CollectCompleted(const ChunkManager& chunks, std::vector<CompletedChunkMesh>& out);
+    void DispatchPending(const ChunkManager& chunks);
+    float DistanceSquaredToViewer(const ChunkCoord& coord, int level) const;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
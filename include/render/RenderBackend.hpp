@@ -0,0 +1,18 @@
+#pragma once
+
+#include "render/RenderCommandList.hpp"
+
+namespace BoxelGame {
+
+// コマンドリストをOpenGL呼び出しへ変換する
+// GLコンテキストが現在のスレッドに結び付いている状態で呼び出すこと
+class RenderBackend {
+public:
+    RenderBackend() = delete;
+
+    static void Execute(const RenderCommandList& commands);
+    // バインド中のVAO/VBOにPackedVoxelVertexの頂点属性（uvec2）を設定する
+    static void SetVoxelVertexLayout();
+};
+
+} // namespace BoxelGame
\ No newline at end of file
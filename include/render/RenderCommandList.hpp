@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace BoxelGame {
+
+enum class RenderCommandType : std::uint8_t {
+    SetViewport,
+    Clear
+};
+
+// 描画コマンド（シミュレーションスレッドで記録し、描画スレッドでGL呼び出しへ変換する）
+struct RenderCommand {
+    RenderCommandType type = RenderCommandType::Clear;
+    std::array<int, 4> viewport{};       // SetViewport: x, y, width, height
+    std::array<float, 4> clearColor{};   // Clear: RGBA
+    bool clearDepth = true;              // Clear: 深度バッファもクリアするか
+};
+
+// 1フレーム分の描画コマンドリスト
+// リストは描画スレッドとの間で使い回され、Reset後も確保済みの容量を保持する
+class RenderCommandList {
+public:
+    RenderCommandList() { m_commands.reserve(256); }
+
+    void Reset(std::uint64_t frameIndex, float alpha) {
+        m_commands.clear();
+        m_frame_index = frameIndex;
+        m_alpha = alpha;
+    }
+
+    void SetViewport(int x, int y, int width, int height) {
+        RenderCommand command;
+        command.type = RenderCommandType::SetViewport;
+        command.viewport = {x, y, width, height};
+        m_commands.push_back(command);
+    }
+
+    void Clear(float r, float g, float b, float a, bool clearDepth = true) {
+        RenderCommand command;
+        command.type = RenderCommandType::Clear;
+        command.clearColor = {r, g, b, a};
+        command.clearDepth = clearDepth;
+        m_commands.push_back(command);
+    }
+
+    const std::vector<RenderCommand>& GetCommands() const { return m_commands; }
+    std::uint64_t GetFrameIndex() const { return m_frame_index; }
+    // 記録時の補間係数
+    float GetAlpha() const { return m_alpha; }
+
+private:
+    std::vector<RenderCommand> m_commands;
+    std::uint64_t m_frame_index = 0;
+    float m_alpha = 0.0f;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
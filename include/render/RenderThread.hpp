@@ -0,0 +1,67 @@
+#pragma once
+
+#include "core/IWindow.hpp"
+#include "render/RenderCommandList.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+
+// GLコンテキストを所有し、シミュレーションスレッドが記録したコマンドリストを実行・提示する描画スレッド
+// コマンドリストはbufferCount個（2: ダブルバッファ, 3: トリプルバッファ）を循環させ、
+// 空きが無い場合はBeginFrameが待機する（シミュレーションは描画よりbufferCount-1フレーム先行できる）
+class RenderThread {
+public:
+    static constexpr std::size_t kMinBufferCount = 2;
+    static constexpr std::size_t kMaxBufferCount = 3;
+
+    // 呼び出し前にwindowのGLコンテキストを呼び出しスレッドから解除しておくこと
+    explicit RenderThread(IWindow& window, std::size_t bufferCount = kMaxBufferCount);
+    // 提出済みフレームを全て提示してから停止し、GLコンテキストを解除する
+    ~RenderThread();
+
+    // コピー・ムーブ操作を削除（RAII/一意所有権）
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+    RenderThread(RenderThread&&) = delete;
+    RenderThread& operator=(RenderThread&&) = delete;
+
+    // 記録用の空きコマンドリストを取得（空きが無ければ描画スレッドの提示を待つ）
+    RenderCommandList& BeginFrame(std::uint64_t frameIndex, float alpha);
+    // BeginFrameで取得したリストを描画スレッドへ提出
+    void SubmitFrame();
+    // 提出済みフレームが全て提示されるまで待機
+    void Flush();
+
+    std::size_t GetBufferCount() const { return m_lists.size(); }
+    std::uint64_t GetPresentedFrameCount() const { return m_presented_frames.load(std::memory_order_acquire); }
+    // BeginFrameが空きリストを待った累計時間（描画側がボトルネックになっている指標）
+    double GetStallSeconds() const { return m_stall_seconds; }
+
+private:
+    IWindow& m_window;
+    std::vector<RenderCommandList> m_lists;
+
+    std::mutex m_mutex;
+    std::condition_variable m_free_cv;   // 空きリスト発生・全フレーム提示完了の通知
+    std::condition_variable m_ready_cv;  // 提出リスト発生・停止要求の通知
+    std::deque<std::size_t> m_free;
+    std::deque<std::size_t> m_ready;
+    std::size_t m_recording = SIZE_MAX;  // 記録中のリスト（シミュレーションスレッドのみ参照）
+    std::size_t m_in_flight = 0;         // 提出済みで未提示のフレーム数
+    bool m_stop = false;
+
+    std::atomic<std::uint64_t> m_presented_frames{0};
+    double m_stall_seconds = 0.0;
+    std::thread m_thread;
+
+    void ThreadMain();
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace BoxelGame {
+
+// GPUへ送るボクセル頂点（2語 = 8バイト）
+// 浮動小数点の位置・法線・UV・テクスチャ層（36バイト）の代わりに整数ビット列で持ち、
+// 頂点シェーダー（assets/shaders/voxel.vert）で展開する
+//
+// word0:
+//   [0, 15)  位置 x, y, z（チャンクローカル、各5ビット、0..16）
+//   [15, 18) 法線インデックス（BlockFaceの値）
+//   [18, 20) AOレベル（0: 最も暗い .. 3: 遮蔽無し）
+//   [20, 22) 四角形内の角（ビット0: u側, ビット1: v側）
+//   [22, 26) 四角形の幅 - 1
+//   [26, 30) 四角形の高さ - 1
+// word1:
+//   [0, 16)  テクスチャ配列の層
+//   [16, 32) 予約（ライト値用）
+struct PackedVoxelVertex {
+    std::uint32_t word0 = 0;
+    std::uint32_t word1 = 0;
+
+    static constexpr int kPositionBits = 5;
+    static constexpr std::uint32_t kMaxPosition = (1u << kPositionBits) - 1;
+    static constexpr std::uint32_t kMaxQuadSize = 16;
+    static constexpr std::uint32_t kMaxAmbientOcclusion = 3;
+    static constexpr std::uint32_t kMaxTextureLayer = 0xFFFF;
+
+    static constexpr PackedVoxelVertex Pack(std::uint32_t x, std::uint32_t y, std::uint32_t z,
+                                            std::uint32_t normal, std::uint32_t ao,
+                                            std::uint32_t cornerU, std::uint32_t cornerV,
+                                            std::uint32_t width, std::uint32_t height,
+                                            std::uint32_t textureLayer) {
+        PackedVoxelVertex vertex;
+        vertex.word0 = x | (y << 5) | (z << 10) | (normal << 15) | (ao << 18) |
+                       (cornerU << 20) | (cornerV << 21) | ((width - 1) << 22) | ((height - 1) << 26);
+        vertex.word1 = textureLayer;
+        return vertex;
+    }
+
+    constexpr std::uint32_t GetX() const { return word0 & 0x1F; }
+    constexpr std::uint32_t GetY() const { return (word0 >> 5) & 0x1F; }
+    constexpr std::uint32_t GetZ() const { return (word0 >> 10) & 0x1F; }
+    constexpr std::uint32_t GetNormal() const { return (word0 >> 15) & 0x7; }
+    constexpr std::uint32_t GetAmbientOcclusion() const { return (word0 >> 18) & 0x3; }
+    constexpr std::uint32_t GetCornerU() const { return (word0 >> 20) & 0x1; }
+    constexpr std::uint32_t GetCornerV() const { return (word0 >> 21) & 0x1; }
+    constexpr std::uint32_t GetWidth() const { return ((word0 >> 22) & 0xF) + 1; }
+    constexpr std::uint32_t GetHeight() const { return ((word0 >> 26) & 0xF) + 1; }
+    constexpr std::uint32_t GetTextureLayer() const { return word1 & 0xFFFF; }
+
+    friend constexpr bool operator==(const PackedVoxelVertex&, const PackedVoxelVertex&) = default;
+};
+
+static_assert(sizeof(PackedVoxelVertex) == 8, "PackedVoxelVertex must stay two 32-bit words");
+static_assert(PackedVoxelVertex::Pack(16, 16, 16, 5, 3, 1, 1, 16, 16, 0xFFFF).GetZ() == 16);
+static_assert(PackedVoxelVertex::Pack(16, 16, 16, 5, 3, 1, 1, 16, 16, 0xFFFF).GetHeight() == 16);
+static_assert(PackedVoxelVertex::Pack(0, 0, 0, 0, 0, 0, 0, 1, 1, 0).word0 == 0);
+
+// 頂点属性の配置（glVertexAttribIPointer で uvec2 として渡す）
+constexpr unsigned int kVoxelVertexAttributeLocation = 0;
+constexpr int kVoxelVertexComponentCount = 2;
+constexpr std::size_t kVoxelVertexStride = sizeof(PackedVoxelVertex);
+
+// 1四角形あたりの頂点数・インデックス数（インデックスは全四角形で共通の 0,1,2, 0,2,3）
+constexpr int kVerticesPerQuad = 4;
+constexpr int kIndicesPerQuad = 6;
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+namespace BoxelGame {
+
+// ブロック種別ID（0は空気）
+using BlockId = std::uint16_t;
+
+namespace Blocks {
+
+constexpr BlockId Air = 0;
+constexpr BlockId Stone = 1;
+constexpr BlockId Dirt = 2;
+constexpr BlockId Grass = 3;
+constexpr BlockId Sand = 4;
+constexpr BlockId Wood = 5;
+constexpr BlockId Leaves = 6;
+constexpr BlockId Glass = 7;
+constexpr BlockId Torch = 8;
+
+} // namespace Blocks
+
+// ブロックの面方向
+enum class BlockFace : std::uint8_t {
+    PositiveX = 0,
+    NegativeX,
+    PositiveY,
+    NegativeY,
+    PositiveZ,
+    NegativeZ
+};
+
+constexpr int kBlockFaceCount = 6;
+
+// 面の法線軸（0: X, 1: Y, 2: Z）
+constexpr int GetFaceAxis(BlockFace face) {
+    return static_cast<int>(face) / 2;
+}
+
+constexpr bool IsPositiveFace(BlockFace face) {
+    return (static_cast<int>(face) & 1) == 0;
+}
+
+// 法線軸と向き（正: true）から面を求める
+constexpr BlockFace MakeBlockFace(int axis, bool positive) {
+    return static_cast<BlockFace>(axis * 2 + (positive ? 0 : 1));
+}
+
+// ブロックの性質（不透明・発光・テクスチャ等）は world/BlockRegistry.hpp の表から引く
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "world/Block.hpp"
+#include "world/ChunkLight.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace BoxelGame {
+
+// テクスチャ配列の層
+namespace BlockTextures {
+
+constexpr std::uint16_t Stone = 0;
+constexpr std::uint16_t Dirt = 1;
+constexpr std::uint16_t GrassTop = 2;
+constexpr std::uint16_t GrassSide = 3;
+constexpr std::uint16_t Sand = 4;
+constexpr std::uint16_t WoodSide = 5;
+constexpr std::uint16_t WoodTop = 6;
+constexpr std::uint16_t Leaves = 7;
+constexpr std::uint16_t Glass = 8;
+constexpr std::uint16_t Torch = 9;
+constexpr std::uint16_t Missing = 10;  // 未登録のブロック
+
+} // namespace BlockTextures
+
+// 面ごとのテクスチャ層（BlockFaceの順）
+using BlockFaceTextures = std::array<std::uint16_t, kBlockFaceCount>;
+
+constexpr BlockFaceTextures AllFaces(std::uint16_t layer) {
+    return {layer, layer, layer, layer, layer, layer};
+}
+
+constexpr BlockFaceTextures TopSideBottom(std::uint16_t top, std::uint16_t side, std::uint16_t bottom) {
+    return {side, side, top, bottom, side, side};
+}
+
+// ブロック1種類の定義
+struct BlockDefinition {
+    BlockId id = Blocks::Air;
+    std::string_view name;
+    bool cube = false;         // 立方体として面を描画する（メッシュ生成・LOD縮小）
+    bool opaque = false;       // 光を通さない（光の伝播・視線判定）
+    bool solid = false;        // 衝突判定を持つ
+    bool transparent = false;  // 透けて見える（半透明描画の対象、不透明ブロックではないこと）
+    std::uint8_t lightEmission = 0;  // 発する光の強さ（0..kMaxLightLevel）
+    float hardness = 0.0f;           // 破壊に要する時間の係数（0は即時）
+    BlockFaceTextures textures = AllFaces(BlockTextures::Missing);
+};
+
+// ブロックの定義（IDの順に並べる。追加時は下のstatic_assertで形式を検証する）
+// 隣接する面を隠し、AOの遮蔽物となるのは不透明な立方体のみ（葉・ガラス越しの面は描画する）
+// 松明は専用の形状が無いため、暫定で立方体として描画する（不透明でないため周囲の面は隠さない）
+inline constexpr BlockDefinition kBlockDefinitions[] = {
+    // id             name      cube   opaque solid  transp emit hardness textures
+    {Blocks::Air,    "air",    false, false, false, false, 0,  0.0f, AllFaces(BlockTextures::Missing)},
+    {Blocks::Stone,  "stone",  true,  true,  true,  false, 0,  1.5f, AllFaces(BlockTextures::Stone)},
+    {Blocks::Dirt,   "dirt",   true,  true,  true,  false, 0,  0.5f, AllFaces(BlockTextures::Dirt)},
+    {Blocks::Grass,  "grass",  true,  true,  true,  false, 0,  0.6f,
+     TopSideBottom(BlockTextures::GrassTop, BlockTextures::GrassSide, BlockTextures::Dirt)},
+    {Blocks::Sand,   "sand",   true,  true,  true,  false, 0,  0.5f, AllFaces(BlockTextures::Sand)},
+    {Blocks::Wood,   "wood",   true,  true,  true,  false, 0,  2.0f,
+     TopSideBottom(BlockTextures::WoodTop, BlockTextures::WoodSide, BlockTextures::WoodTop)},
+    {Blocks::Leaves, "leaves", true,  false, true,  true,  0,  0.2f, AllFaces(BlockTextures::Leaves)},
+    {Blocks::Glass,  "glass",  true,  false, true,  true,  0,  0.3f, AllFaces(BlockTextures::Glass)},
+    {Blocks::Torch,  "torch",  true,  false, false, false, 14, 0.0f, AllFaces(BlockTextures::Torch)},
+};
+
+constexpr std::size_t kBlockTypeCount = std::size(kBlockDefinitions);
+
+// 未登録のIDを読んだ場合の性質（空気と区別できるよう、欠落テクスチャの立方体として描画する）
+inline constexpr BlockDefinition kUnknownBlockDefinition{
+    Blocks::Air, "unknown", true, true, true, false, 0, 1.0f, AllFaces(BlockTextures::Missing)};
+
+namespace BlockRegistryValidation {
+
+constexpr bool HasSequentialIds(std::span<const BlockDefinition> definitions) {
+    for (std::size_t i = 0; i < definitions.size(); ++i) {
+        if (definitions[i].id != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool IsAirFirst(std::span<const BlockDefinition> definitions) {
+    const BlockDefinition& air = definitions[0];
+    return air.id == Blocks::Air && !air.cube && !air.opaque && !air.solid && air.lightEmission == 0;
+}
+
+constexpr bool HasConsistentFlags(const BlockDefinition& definition) {
+    // 光を遮るのは立方体のみ、透けて見えるのは不透明でない立方体のみ
+    return (!definition.opaque || definition.cube) &&
+           (!definition.transparent || (definition.cube && !definition.opaque)) &&
+           definition.lightEmission <= kMaxLightLevel && definition.hardness >= 0.0f;
+}
+
+constexpr bool HasConsistentFlags(std::span<const BlockDefinition> definitions) {
+    for (const BlockDefinition& definition : definitions) {
+        if (!HasConsistentFlags(definition)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool HasUniqueNames(std::span<const BlockDefinition> definitions) {
+    for (std::size_t i = 0; i < definitions.size(); ++i) {
+        if (definitions[i].name.empty()) {
+            return false;
+        }
+        for (std::size_t j = i + 1; j < definitions.size(); ++j) {
+            if (definitions[i].name == definitions[j].name) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace BlockRegistryValidation
+
+static_assert(kBlockTypeCount > 0 && BlockRegistryValidation::IsAirFirst(kBlockDefinitions),
+              "ブロック定義の先頭は空気（描画・光・衝突無し）であること");
+static_assert(BlockRegistryValidation::HasSequentialIds(kBlockDefinitions),
+              "ブロック定義はIDの順に0から連番で並べること");
+static_assert(BlockRegistryValidation::HasConsistentFlags(kBlockDefinitions) &&
+              BlockRegistryValidation::HasConsistentFlags(kUnknownBlockDefinition),
+              "不透明・透明は立方体のみ、透明は不透明と両立しない、発光は0..15、硬さは0以上であること");
+static_assert(BlockRegistryValidation::HasUniqueNames(kBlockDefinitions),
+              "ブロック名は空でなく重複しないこと");
+
+// ブロックIDで引くビット集合
+template <std::size_t Size>
+class BlockFlagSet {
+public:
+    constexpr void Set(std::size_t index) { m_words[index >> 6] |= std::uint64_t{1} << (index & 63); }
+    constexpr bool Test(std::size_t index) const { return ((m_words[index >> 6] >> (index & 63)) & 1) != 0; }
+
+private:
+    std::array<std::uint64_t, (Size + 63) / 64> m_words{};
+};
+
+// 定義から生成した性質ごとの表（SoA）。末尾の1行は未登録のID用
+// 描画・光・物理の内側のループはIDで1回引くだけで済む
+struct BlockPropertyTables {
+    static constexpr std::size_t kSize = kBlockTypeCount + 1;
+
+    BlockFlagSet<kSize> cube;
+    BlockFlagSet<kSize> occludesFaces;  // 不透明な立方体（cube && opaque）
+    BlockFlagSet<kSize> opaque;
+    BlockFlagSet<kSize> solid;
+    BlockFlagSet<kSize> transparent;
+    std::array<std::uint8_t, kSize> lightEmission{};
+    std::array<float, kSize> hardness{};
+    std::array<std::array<std::uint16_t, kSize>, kBlockFaceCount> textureLayers{};  // [面][ID]
+    std::array<std::string_view, kSize> names{};
+};
+
+constexpr BlockPropertyTables BuildBlockPropertyTables() {
+    BlockPropertyTables tables;
+    for (std::size_t i = 0; i < BlockPropertyTables::kSize; ++i) {
+        const BlockDefinition& definition = i < kBlockTypeCount ? kBlockDefinitions[i] : kUnknownBlockDefinition;
+        if (definition.cube) {
+            tables.cube.Set(i);
+        }
+        if (definition.cube && definition.opaque) {
+            tables.occludesFaces.Set(i);
+        }
+        if (definition.opaque) {
+            tables.opaque.Set(i);
+        }
+        if (definition.solid) {
+            tables.solid.Set(i);
+        }
+        if (definition.transparent) {
+            tables.transparent.Set(i);
+        }
+        tables.lightEmission[i] = definition.lightEmission;
+        tables.hardness[i] = definition.hardness;
+        for (int face = 0; face < kBlockFaceCount; ++face) {
+            tables.textureLayers[face][i] = definition.textures[face];
+        }
+        tables.names[i] = definition.name;
+    }
+    return tables;
+}
+
+inline constexpr BlockPropertyTables kBlockProperties = BuildBlockPropertyTables();
+
+// 表の行（未登録のIDは末尾の行）
+constexpr std::size_t ToBlockTableIndex(BlockId block) {
+    return block < kBlockTypeCount ? block : kBlockTypeCount;
+}
+
+constexpr bool IsRegisteredBlock(BlockId block) {
+    return block < kBlockTypeCount;
+}
+
+// 立方体として面を描画するか
+constexpr bool IsCubeBlock(BlockId block) {
+    return kBlockProperties.cube.Test(ToBlockTableIndex(block));
+}
+
+// 隣接するブロックの面を隠し、AOの遮蔽物となるか
+constexpr bool IsFaceOccludingBlock(BlockId block) {
+    return kBlockProperties.occludesFaces.Test(ToBlockTableIndex(block));
+}
+
+// 光を通さないか
+constexpr bool IsOpaqueBlock(BlockId block) {
+    return kBlockProperties.opaque.Test(ToBlockTableIndex(block));
+}
+
+constexpr bool IsSolidBlock(BlockId block) {
+    return kBlockProperties.solid.Test(ToBlockTableIndex(block));
+}
+
+constexpr bool IsTransparentBlock(BlockId block) {
+    return kBlockProperties.transparent.Test(ToBlockTableIndex(block));
+}
+
+// ブロックが発する光の強さ（0..15）
+constexpr std::uint8_t GetBlockLightEmission(BlockId block) {
+    return kBlockProperties.lightEmission[ToBlockTableIndex(block)];
+}
+
+constexpr float GetBlockHardness(BlockId block) {
+    return kBlockProperties.hardness[ToBlockTableIndex(block)];
+}
+
+// 面に貼るテクスチャ配列の層
+constexpr std::uint16_t GetBlockTextureLayer(BlockId block, BlockFace face) {
+    return kBlockProperties.textureLayers[static_cast<int>(face)][ToBlockTableIndex(block)];
+}
+
+constexpr std::string_view GetBlockName(BlockId block) {
+    return kBlockProperties.names[ToBlockTableIndex(block)];
+}
+
+static_assert(GetBlockName(Blocks::Torch) == "torch" && GetBlockLightEmission(Blocks::Torch) == 14);
+static_assert(!IsCubeBlock(Blocks::Air) && IsOpaqueBlock(Blocks::Stone) && !IsOpaqueBlock(Blocks::Glass));
+static_assert(IsFaceOccludingBlock(Blocks::Stone) && IsCubeBlock(Blocks::Glass) && !IsFaceOccludingBlock(Blocks::Glass) &&
+              !IsFaceOccludingBlock(Blocks::Torch));
+static_assert(GetBlockTextureLayer(Blocks::Grass, BlockFace::PositiveY) == BlockTextures::GrassTop);
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "world/Block.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace BoxelGame {
+
+// チャンクの一辺のブロック数（仕様 6.1: 16×16×16）
+constexpr int kChunkSize = 16;
+constexpr int kChunkSizeLog2 = 4;
+constexpr int kChunkVolume = kChunkSize * kChunkSize * kChunkSize;
+
+// チャンク内ローカル座標 → 格納順インデックス（x最内、次にz、最外y）
+constexpr int ToChunkIndex(int x, int y, int z) {
+    return x | (z << kChunkSizeLog2) | (y << (kChunkSizeLog2 * 2));
+}
+
+// パレット圧縮された16³ブロックストレージ
+// チャンク内で使われるブロックIDをパレットに集め、各ブロックはパレット番号を
+// 0/1/2/4/8/16ビット幅で64ビット語へ詰めて保持する（語境界をまたがない幅のみ使用）
+// 一様なチャンク（全て空気・全て石など）は0ビットで、パレット1件のみを持つ
+// 書き込みでパレットが溢れると幅を拡大し、使用種類が十分減ると縮小する
+// スレッドセーフではない（読み取りのみであれば複数スレッドから同時に呼び出し可能）
+class Chunk {
+public:
+    // fillで一様に埋めたチャンク
+    explicit Chunk(BlockId fill = Blocks::Air);
+
+    BlockId Get(int x, int y, int z) const { return GetByIndex(ToChunkIndex(x, y, z)); }
+    BlockId GetByIndex(int index) const {
+        if (m_bits_per_block == 0) {
+            return m_palette[0];
+        }
+        const std::size_t bitOffset = static_cast<std::size_t>(index) * m_bits_per_block;
+        const std::uint64_t word = m_data[bitOffset >> 6];
+        return m_palette[(word >> (bitOffset & 63)) & m_index_mask];
+    }
+
+    // 値が変化した場合にtrueを返す
+    bool Set(int x, int y, int z, BlockId block) { return SetByIndex(ToChunkIndex(x, y, z), block); }
+    bool SetByIndex(int index, BlockId block);
+
+    // 全ブロックを同じIDにする（0ビットの一様チャンクになる）
+    void Fill(BlockId block);
+    // 格納順（ToChunkIndex）のkChunkVolume個のブロックで置き換え、最小のビット幅で格納
+    void Assign(std::span<const BlockId> blocks);
+    // 格納順でkChunkVolume個のブロックへ展開
+    void Unpack(std::span<BlockId> out) const;
+
+    bool IsUniform() const { return m_bits_per_block == 0; }
+    // 一様チャンクのブロックID（IsUniformの場合のみ有効）
+    BlockId GetUniformBlock() const { return m_palette[0]; }
+    bool IsEmpty() const { return IsUniform() && m_palette[0] == Blocks::Air; }
+
+    // 内容の版番号（変更のたびに全チャンクで一意な値へ更新される）
+    // 非同期メッシュ生成等で、スナップショット後に変更・再ロードされたかの判定に使う
+    std::uint64_t GetRevision() const { return m_revision; }
+
+    int GetBitsPerBlock() const { return m_bits_per_block; }
+    // 使用中のパレット項目数（チャンク内のブロック種類数）
+    std::size_t GetPaletteSize() const { return m_live_palette_entries; }
+    // パレット・パック済み配列のヒープ使用量（バイト）
+    std::size_t GetMemoryUsage() const;
+
+private:
+    std::vector<BlockId> m_palette;
+    std::vector<std::uint16_t> m_palette_counts;  // パレット項目ごとの使用ブロック数（0は空き項目）
+    std::vector<std::uint64_t> m_data;            // パック済みパレット番号
+    std::size_t m_live_palette_entries = 1;
+    int m_bits_per_block = 0;
+    std::uint64_t m_index_mask = 0;
+    std::uint64_t m_revision = 0;
+
+    std::uint32_t GetPaletteIndex(int index) const;
+    void SetPaletteIndex(int index, std::uint32_t paletteIndex);
+    // パレット番号を割り当て（無ければ追加し、必要ならビット幅を拡大）
+    std::uint32_t AcquirePaletteIndex(BlockId block);
+    // ビット幅を変更して全ブロックを詰め直す（compactがtrueなら未使用パレット項目を除去）
+    void Repack(int bitsPerBlock, bool compact);
+    void ShrinkIfSparse();
+
+    static int BitsForPaletteSize(std::size_t paletteSize);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "world/Chunk.hpp"
+#include <cstdint>
+
+namespace BoxelGame {
+
+// チャンク座標（ブロック座標 / kChunkSize、負方向は切り捨て）
+struct ChunkCoord {
+    int x = 0;
+    int y = 0;
+    int z = 0;
+
+    friend constexpr bool operator==(const ChunkCoord&, const ChunkCoord&) = default;
+};
+
+// 各軸21ビット（符号付き）で64ビットキーへ詰める
+constexpr int kChunkCoordBits = 21;
+constexpr int kChunkCoordMin = -(1 << (kChunkCoordBits - 1));
+constexpr int kChunkCoordMax = (1 << (kChunkCoordBits - 1)) - 1;
+
+// 詰めたキーで表せる範囲か（範囲外の座標は詰めると別の座標と同じキーになる）
+constexpr bool IsValidChunkCoord(const ChunkCoord& coord) {
+    return coord.x >= kChunkCoordMin && coord.x <= kChunkCoordMax &&
+           coord.y >= kChunkCoordMin && coord.y <= kChunkCoordMax &&
+           coord.z >= kChunkCoordMin && coord.z <= kChunkCoordMax;
+}
+
+constexpr std::uint64_t PackChunkCoord(const ChunkCoord& coord) {
+    constexpr std::uint64_t mask = (std::uint64_t{1} << kChunkCoordBits) - 1;
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.x)) & mask) |
+           ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.y)) & mask) << kChunkCoordBits) |
+           ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.z)) & mask) << (kChunkCoordBits * 2));
+}
+
+constexpr ChunkCoord UnpackChunkCoord(std::uint64_t key) {
+    // 21ビットの符号拡張
+    constexpr auto extend = [](std::uint64_t value) {
+        constexpr std::uint64_t mask = (std::uint64_t{1} << kChunkCoordBits) - 1;
+        constexpr std::uint64_t sign = std::uint64_t{1} << (kChunkCoordBits - 1);
+        const std::uint64_t bits = value & mask;
+        return static_cast<int>(static_cast<std::int64_t>(bits ^ sign) - static_cast<std::int64_t>(sign));
+    };
+    return {extend(key), extend(key >> kChunkCoordBits), extend(key >> (kChunkCoordBits * 2))};
+}
+
+// ブロック座標 → チャンク座標（算術シフトによる床関数）
+constexpr int BlockToChunk(int block) {
+    return block >> kChunkSizeLog2;
+}
+
+constexpr ChunkCoord BlockToChunkCoord(int x, int y, int z) {
+    return {BlockToChunk(x), BlockToChunk(y), BlockToChunk(z)};
+}
+
+// ブロック座標 → チャンク内ローカル座標 [0, kChunkSize)
+constexpr int BlockToLocal(int block) {
+    return block & (kChunkSize - 1);
+}
+
+static_assert(UnpackChunkCoord(PackChunkCoord({-1, 2, -3})) == ChunkCoord{-1, 2, -3});
+static_assert(UnpackChunkCoord(PackChunkCoord({kChunkCoordMin, 0, kChunkCoordMax})) ==
+              ChunkCoord{kChunkCoordMin, 0, kChunkCoordMax});
+static_assert(BlockToChunk(-1) == -1 && BlockToLocal(-1) == kChunkSize - 1);
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "world/Chunk.hpp"
+#include <array>
+#include <cstdint>
+
+namespace BoxelGame {
+
+constexpr std::uint8_t kMaxLightLevel = 15;
+
+// 光の種類（空からの光・発光ブロックからの光）
+enum class LightChannel : std::uint8_t {
+    Sky = 0,
+    Block
+};
+
+constexpr int kLightChannelCount = 2;
+
+// 1チャンク分の光量（0..15）を4ビットずつ詰めた配列（インデックスはToChunkIndex）
+class LightNibbleArray {
+public:
+    std::uint8_t Get(int index) const {
+        return static_cast<std::uint8_t>((m_data[index >> 1] >> ((index & 1) * 4)) & 0xF);
+    }
+    void Set(int index, std::uint8_t level) {
+        std::uint8_t& pair = m_data[index >> 1];
+        const int shift = (index & 1) * 4;
+        pair = static_cast<std::uint8_t>((pair & ~(0xF << shift)) | (level << shift));
+    }
+    void Fill(std::uint8_t level) {
+        m_data.fill(static_cast<std::uint8_t>(level | (level << 4)));
+    }
+
+private:
+    std::array<std::uint8_t, kChunkVolume / 2> m_data{};
+};
+
+// チャンクの空の光・ブロックの光
+struct ChunkLight {
+    std::array<LightNibbleArray, kLightChannelCount> channels;
+
+    std::uint8_t Get(LightChannel channel, int index) const {
+        return channels[static_cast<int>(channel)].Get(index);
+    }
+    void Set(LightChannel channel, int index, std::uint8_t level) {
+        channels[static_cast<int>(channel)].Set(index, level);
+    }
+};
+
+} // namespace BoxelGame
\ No newline at end of file
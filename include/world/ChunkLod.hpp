@@ -0,0 +1,49 @@
+#pragma once
+
+#include "world/Chunk.hpp"
+#include "world/ChunkCoord.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/PaddedChunk.hpp"
+#include <cstdint>
+#include <span>
+
+namespace BoxelGame {
+
+// 距離に応じた詳細度（LOD）
+// レベルLの領域は 2^L × 2^L × 2^L チャンクを1セル = 2^L ブロックの16³グリッドへ縮小したもので、
+// レベル0（通常のチャンク）と同じメッシャーでメッシュ化し、描画時に 2^L 倍する
+constexpr int kMaxLodLevel = 3;
+constexpr int kLodLevelCount = kMaxLodLevel + 1;
+
+constexpr int GetLodScale(int level) {
+    return 1 << level;
+}
+
+// チャンク座標 → それを含むレベルLの領域座標（負方向も床関数）
+constexpr ChunkCoord ToLodRegion(const ChunkCoord& chunk, int level) {
+    return {chunk.x >> level, chunk.y >> level, chunk.z >> level};
+}
+
+// 領域の最小チャンク座標
+constexpr ChunkCoord GetLodRegionOrigin(const ChunkCoord& region, int level) {
+    return {region.x * GetLodScale(level), region.y * GetLodScale(level), region.z * GetLodScale(level)};
+}
+
+// 1チャンクを (16 >> level)³ セルへ縮小する（out は x最内、次にz、最外y）
+// 2×2×2ごとに段階的に縮小し、子に1つでも立方体ブロック（IsCubeBlock）があれば立方体とする（保守的な縮小）
+// これにより粗いレベルの表面は細かいレベルの表面より下がらない
+// セルの種別は上側の層の立方体ブロックを優先した最頻値（地表の種別が上面に残る）
+void DownsampleChunk(const Chunk& chunk, int level, std::span<BlockId> out);
+
+// レベルLの領域をメッシャー入力へ構築する（未ロードのチャンクは空気）
+// 境界（パディング）は常に空気とし、領域の外周面を必ず生成する。
+// 隣接領域のLODが異なっても外周面が壁（スカート）となり、縮小が保守的なため継ぎ目に隙間が生じない
+void BuildLodChunk(const ChunkManager& chunks, const ChunkCoord& region, int level, PaddedChunk& out);
+
+// 領域内のロード済みチャンクの最大の版と数から求めた値（いずれかの変更・ロード・アンロードで必ず変わる）
+// ロード済みのチャンクが無い場合は0
+// レベル0はスナップショットの入力であるチャンクと26近傍の版から求め（チャンク未ロードなら0）、
+// 境界の近傍が変更・ロード・アンロードされた場合も実行中の生成結果を破棄できるようにする
+std::uint64_t ComputeLodRevision(const ChunkManager& chunks, const ChunkCoord& region, int level);
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "world/Chunk.hpp"
+#include "world/ChunkCoord.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace BoxelGame {
+
+// チャンクとその周囲26チャンクへのポインタを保持する3×3×3近傍
+// メッシュ生成・ライティングで境界をまたぐブロック参照をハッシュ検索無しで行う
+// 未ロードの近傍は空気として扱う
+class ChunkNeighborhood {
+public:
+    ChunkNeighborhood() { m_chunks.fill(nullptr); }
+
+    // (dx, dy, dz) ∈ [-1, 1]³ のチャンク（未ロードならnullptr）
+    const Chunk* GetChunk(int dx, int dy, int dz) const { return m_chunks[SlotIndex(dx, dy, dz)]; }
+    const Chunk* GetCenter() const { return m_chunks[13]; }
+    void SetChunk(int dx, int dy, int dz, const Chunk* chunk) { m_chunks[SlotIndex(dx, dy, dz)] = chunk; }
+
+    // 中心チャンク基準のローカル座標（各軸 [-kChunkSize, 2*kChunkSize)）でブロックを取得
+    BlockId GetBlock(int x, int y, int z) const {
+        const Chunk* chunk = m_chunks[SlotIndex(FloorDiv(x), FloorDiv(y), FloorDiv(z))];
+        return chunk ? chunk->Get(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)) : Blocks::Air;
+    }
+
+private:
+    std::array<const Chunk*, 27> m_chunks;
+
+    static constexpr int FloorDiv(int local) { return local >> kChunkSizeLog2; }
+    static constexpr int SlotIndex(int dx, int dy, int dz) { return (dx + 1) + (dz + 1) * 3 + (dy + 1) * 9; }
+};
+
+// ロード済みチャンクの管理
+// チャンク座標を64ビットキーに詰め、線形探索のオープンアドレス法ハッシュ表（ノード確保無し）で保持する
+// チャンク本体はヒープに個別確保し、表の再ハッシュ後もChunk*は有効なまま
+// スレッドセーフではない（変更はメインスレッドのみ、変更が無い間は複数スレッドから読み取り可能）
+class ChunkManager {
+public:
+    explicit ChunkManager(std::size_t initialCapacity = 1024);
+
+    ChunkManager(const ChunkManager&) = delete;
+    ChunkManager& operator=(const ChunkManager&) = delete;
+
+    // 範囲外の座標（IsValidChunkCoord）は登録できないため常にnullptr
+    Chunk* Find(const ChunkCoord& coord) {
+        return IsValidChunkCoord(coord) ? FindByKey(PackChunkCoord(coord)) : nullptr;
+    }
+    const Chunk* Find(const ChunkCoord& coord) const {
+        return IsValidChunkCoord(coord) ? FindByKey(PackChunkCoord(coord)) : nullptr;
+    }
+    bool Contains(const ChunkCoord& coord) const { return Find(coord) != nullptr; }
+
+    // チャンクを登録（既存のチャンクは置き換える）
+    Chunk& Insert(const ChunkCoord& coord, std::unique_ptr<Chunk> chunk);
+    // 未ロードならfillで埋めたチャンクを生成
+    Chunk& GetOrCreate(const ChunkCoord& coord, BlockId fill = Blocks::Air);
+    // チャンクを取り外して返す（未ロードならnullptr）
+    std::unique_ptr<Chunk> Remove(const ChunkCoord& coord);
+    void Clear();
+
+    // ワールドのブロック座標でアクセス（未ロードのチャンクは空気、書き込みは無視してfalse）
+    BlockId GetBlock(int x, int y, int z) const;
+    bool SetBlock(int x, int y, int z, BlockId block);
+
+    // 3×3×3近傍を取得
+    ChunkNeighborhood GetNeighborhood(const ChunkCoord& center) const;
+
+    // ロード済みの全チャンクを走査（走査中の追加・削除は不可）
+    template <typename Function>
+    void ForEach(Function&& function) const {
+        for (const Slot& slot : m_slots) {
+            if (slot.key != kEmptyKey) {
+                function(UnpackChunkCoord(slot.key), *slot.chunk);
+            }
+        }
+    }
+
+    std::size_t GetChunkCount() const { return m_count; }
+    std::size_t GetCapacity() const { return m_slots.size(); }
+    // 全チャンクのブロックストレージ使用量（バイト）
+    std::size_t GetMemoryUsage() const;
+
+private:
+    // 21ビット×3の詰めたキーでは使われない値
+    static constexpr std::uint64_t kEmptyKey = ~std::uint64_t{0};
+
+    struct Slot {
+        std::uint64_t key = kEmptyKey;
+        std::unique_ptr<Chunk> chunk;
+    };
+
+    std::vector<Slot> m_slots;  // 容量は2の冪
+    std::size_t m_count = 0;
+    int m_shift = 64;           // フィボナッチハッシュのシフト量（64 - log2(容量)）
+
+    Chunk* FindByKey(std::uint64_t key) const;
+    std::size_t HomeSlot(std::uint64_t key) const;
+    void Rehash(std::size_t capacity);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "core/MpmcQueue.hpp"
+#include "world/ChunkCoord.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/TerrainGenerator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace BoxelGame {
+
+struct ChunkStreamingConfig {
+    int spawnChunkX = 0;
+    int spawnChunkZ = 0;
+    int viewDistance = 8;      // 読み込む範囲（スポーン列からの水平チェビシェフ距離、チャンク単位）
+    int firstFrameRadius = 2;  // 最初のフレームを表示する前にメッシュ化を終える範囲
+    int minChunkY = 0;         // 読み込む高さの範囲（高さ256のワールドは0..15）
+    int maxChunkY = 15;
+    std::size_t maxJobsInFlight = 32;  // 同時に実行する生成ジョブ数の上限
+};
+
+// スポーン地点の周囲のチャンクを同心リング順に非同期生成して読み込む
+// リングrはスポーン列からの水平チェビシェフ距離がrの列で、内側のリングから順にジョブへ投入する
+// チャンクは26近傍が全て読み込まれた（または範囲外の）時点でメッシュ化可能として通知し、
+// 境界の面・AOを後から作り直さずに済むようにする
+// メッシュ化の完了をNotifyMeshedで受け取り、内側の範囲・全範囲の完了を判定する
+// Update/NotifyMeshed/破棄はメインスレッドから呼ぶこと
+class ChunkStreamer {
+public:
+    ChunkStreamer(JobSystem& jobSystem, TerrainGenerator& generator, const ChunkStreamingConfig& config);
+    // 実行中の生成ジョブ完了を待つ
+    ~ChunkStreamer();
+
+    ChunkStreamer(const ChunkStreamer&) = delete;
+    ChunkStreamer& operator=(const ChunkStreamer&) = delete;
+
+    // 完了した生成結果をchunksへ登録してloadedへ追加し、26近傍が揃ったチャンクをmeshableへ追加する
+    // その後、空き枠分の生成ジョブを投入する（待機しない）
+    void Update(ChunkManager& chunks, std::vector<ChunkCoord>& loaded, std::vector<ChunkCoord>& meshable);
+    // レベル0のメッシュが生成されたことを通知する（範囲外・2回目以降は無視）
+    void NotifyMeshed(const ChunkCoord& coord);
+
+    bool Contains(const ChunkCoord& coord) const;
+    // スポーン列からのリング番号（範囲外は-1）
+    int GetRing(const ChunkCoord& coord) const;
+    // リング順の読み込み順序
+    const std::vector<ChunkCoord>& GetLoadOrder() const { return m_order; }
+
+    // firstFrameRadius以内のチャンクが全てメッシュ化された
+    bool IsFirstFrameReady() const { return m_inner_meshed == m_inner_count; }
+    // 範囲内の全チャンクがメッシュ化された
+    bool IsComplete() const { return m_meshed.size() == m_order.size(); }
+
+    const ChunkStreamingConfig& GetConfig() const { return m_config; }
+    std::size_t GetTotalCount() const { return m_order.size(); }
+    std::size_t GetLoadedCount() const { return m_loaded.size(); }
+    std::size_t GetMeshedCount() const { return m_meshed.size(); }
+    std::size_t GetJobsInFlight() const { return m_jobs_in_flight; }
+
+private:
+    struct GenerationJob {
+        ChunkCoord coord;
+        const ColumnHeightmap* column = nullptr;
+        std::unique_ptr<Chunk> chunk;
+    };
+
+    JobSystem& m_job_system;
+    TerrainGenerator& m_generator;
+    ChunkStreamingConfig m_config;
+    JobCounter m_jobs;
+    MpmcQueue<GenerationJob*> m_completed;
+    std::vector<std::unique_ptr<GenerationJob>> m_job_storage;
+    std::vector<GenerationJob*> m_free_jobs;
+
+    std::vector<ChunkCoord> m_order;
+    std::size_t m_next = 0;  // 次に投入するm_orderの位置
+    std::size_t m_jobs_in_flight = 0;
+
+    std::unordered_set<std::uint64_t> m_loaded;
+    std::unordered_set<std::uint64_t> m_meshable;
+    std::unordered_set<std::uint64_t> m_meshed;
+    std::size_t m_inner_count = 0;
+    std::size_t m_inner_meshed = 0;
+
+    bool IsLoadedOrOutside(const ChunkCoord& coord) const;
+    void CollectCompleted(ChunkManager& chunks, std::vector<ChunkCoord>& loaded, std::vector<ChunkCoord>& meshable);
+    void DispatchJobs();
+};
+
+} // namespace BoxelGame
\ No newline at end of file
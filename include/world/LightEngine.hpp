@@ -0,0 +1,109 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "world/ChunkCoord.hpp"
+#include "world/ChunkLight.hpp"
+#include "world/ChunkManager.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace BoxelGame {
+
+// 空の光・ブロックの光の伝播（幅優先のフラッドフィル）
+// 光は透過ブロック（不透明でないブロック）へ1ブロックごとに1ずつ減衰して広がり、
+// 空の光は最大光量のまま真下へは減衰せずに届く。発光ブロック自身は不透明でも発光量を持つ
+// 上方のチャンクが未ロード（未ライティング）の場合、その上は空が開けているものとして扱う
+//
+// ブロック変更はMarkBlockChangedで記録し、Updateで1回の伝播処理にまとめる。
+// 除去キューで変更箇所に依存していた光を消し、その境界と新しい光源を追加キューから再伝播するため、
+// 影響範囲のセルのみを更新する（チャンク全体を再計算しない）
+// 新規チャンクの初期ライティングはチャンク内の計算をジョブで並列に行い、チャンク間の伝播のみメインスレッドで行う
+// ChunkManagerの変更とこのクラスの呼び出しはメインスレッドから行うこと
+class LightEngine {
+public:
+    explicit LightEngine(const ChunkManager& chunks);
+
+    LightEngine(const LightEngine&) = delete;
+    LightEngine& operator=(const LightEngine&) = delete;
+
+    // ロード済みチャンクの初期ライティング（未ロード・ライティング済みのチャンクは無視する）
+    // scratchは呼び出し中のみ使う作業領域の確保先（フレームアリーナ等）
+    void LightNewChunks(JobSystem& jobs, std::span<const ChunkCoord> coords,
+                        std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+    // アンロード時に光量データを破棄する
+    void RemoveChunk(const ChunkCoord& coord);
+
+    // ブロック変更を記録する（次のUpdateでまとめて伝播する）
+    void MarkBlockChanged(int x, int y, int z);
+    // 記録済みの変更を1回の伝播処理で反映する
+    void Update();
+
+    // 未ライティングの位置は0
+    std::uint8_t GetLight(LightChannel channel, int x, int y, int z) const;
+    std::uint8_t GetSkyLight(int x, int y, int z) const { return GetLight(LightChannel::Sky, x, y, z); }
+    std::uint8_t GetBlockLight(int x, int y, int z) const { return GetLight(LightChannel::Block, x, y, z); }
+    const ChunkLight* FindChunkLight(const ChunkCoord& coord) const;
+
+    std::size_t GetLitChunkCount() const { return m_lights.size(); }
+    std::size_t GetPendingEditCount() const { return m_edits.size(); }
+    // 直前のUpdate・LightNewChunksで伝播キューから処理したセル数
+    std::size_t GetLastVisitedCount() const { return m_last_visited; }
+    // 直前のUpdate・LightNewChunksで光量が変化したチャンク（メッシュへの反映用）
+    const std::vector<ChunkCoord>& GetChangedChunks() const { return m_changed_chunks; }
+
+private:
+    struct LightNode {
+        ChunkCoord coord;
+        std::uint16_t index = 0;
+        std::uint8_t level = 0;
+    };
+
+    // 伝播中に参照するチャンクと光量（どちらかが無ければ伝播しない）
+    struct CellRef {
+        const Chunk* chunk = nullptr;
+        ChunkLight* light = nullptr;
+    };
+
+    struct BlockPosition {
+        int x;
+        int y;
+        int z;
+    };
+
+    const ChunkManager& m_chunks;
+    std::unordered_map<std::uint64_t, std::unique_ptr<ChunkLight>> m_lights;  // 詰めたチャンク座標 → 光量
+    std::vector<BlockPosition> m_edits;
+
+    // 光の種類ごとの追加・除去キュー（先頭位置を進めるFIFO、処理後にクリアして使い回す）
+    std::array<std::vector<LightNode>, kLightChannelCount> m_add_queues;
+    std::array<std::vector<LightNode>, kLightChannelCount> m_remove_queues;
+
+    // 直前に解決したチャンク（伝播は局所的なため同じチャンクの参照が続く）
+    std::uint64_t m_cached_key = 0;
+    CellRef m_cached_ref;
+    bool m_cache_valid = false;
+
+    std::unordered_set<std::uint64_t> m_changed_keys;
+    std::uint64_t m_last_changed_key = 0;
+    bool m_has_last_changed = false;
+    std::vector<ChunkCoord> m_changed_chunks;
+    std::size_t m_last_visited = 0;
+
+    CellRef Resolve(const ChunkCoord& coord);
+    void InvalidateCache() { m_cache_valid = false; }
+    void MarkChanged(const ChunkCoord& coord);
+    void SetLight(LightChannel channel, const ChunkCoord& coord, const CellRef& ref, int index, std::uint8_t level);
+
+    void PropagateRemovals(LightChannel channel);
+    void PropagateAdditions(LightChannel channel);
+    void FinishPass();
+};
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace BoxelGame {
+
+// ノイズのまとめ評価に使う命令セット
+// SSE4.1は4点、AVX2は8点を1命令列で評価する。どれを選んでも結果は同じ（スカラー版とビット単位で一致）
+enum class NoiseBackend : std::uint8_t {
+    Scalar = 0,
+    Sse41,
+    Avx2
+};
+
+const char* GetNoiseBackendName(NoiseBackend backend);
+// 実行中のCPUとビルドが対応しているか
+bool IsNoiseBackendSupported(NoiseBackend backend);
+// 対応している中で最も幅の広い命令セット（初回呼び出し時に判定する）
+NoiseBackend GetBestNoiseBackend();
+
+// シンプレックスノイズ（出力はおおよそ[-1, 1]、格子間隔1）
+float SimplexNoise2D(float x, float y, std::uint32_t seed);
+float SimplexNoise3D(float x, float y, float z, std::uint32_t seed);
+
+// 複数点のまとめ評価（out[i] = noise(x[i], y[i], ...)、各配列の長さは同じであること）
+// 非対応の命令セットを指定した場合はBoxelGameExceptionを送出する
+void SimplexNoise2D(std::span<const float> x, std::span<const float> y, std::span<float> out, std::uint32_t seed,
+                    NoiseBackend backend = GetBestNoiseBackend());
+void SimplexNoise3D(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                    std::span<float> out, std::uint32_t seed, NoiseBackend backend = GetBestNoiseBackend());
+
+// オクターブを重ねたノイズ（fBm）
+// オクターブごとに周波数をlacunarity倍、振幅をgain倍し、振幅の総和で割って[-1, 1]程度へ正規化する
+struct FractalNoiseSettings {
+    std::uint32_t seed = 0;
+    int octaves = 4;
+    float frequency = 1.0f / 64.0f;  // ブロック座標に掛ける最初の周波数
+    float lacunarity = 2.0f;
+    float gain = 0.5f;
+};
+
+// 原点(originX, originZ)から1ブロック間隔の sizeX × sizeZ の格子（out は x最内、次にz）
+void FractalNoise2DGrid(const FractalNoiseSettings& settings, int originX, int originZ, int sizeX, int sizeZ,
+                        std::span<float> out, NoiseBackend backend = GetBestNoiseBackend());
+// sizeX × sizeY × sizeZ の格子（out は x最内、次にz、最外y。16³ならToChunkIndexと同じ並び）
+void FractalNoise3DGrid(const FractalNoiseSettings& settings, int originX, int originY, int originZ,
+                        int sizeX, int sizeY, int sizeZ, std::span<float> out,
+                        NoiseBackend backend = GetBestNoiseBackend());
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "world/Chunk.hpp"
+#include "world/ChunkManager.hpp"
+#include <array>
+
+namespace BoxelGame {
+
+// 周囲1ブロックの境界を含む18³のブロック配列
+// メッシュ生成の入力となるスナップショットで、構築後は元のチャンクと独立して読み取れる
+constexpr int kPaddedChunkSize = kChunkSize + 2;
+constexpr int kPaddedChunkVolume = kPaddedChunkSize * kPaddedChunkSize * kPaddedChunkSize;
+
+struct PaddedChunk {
+    std::array<BlockId, kPaddedChunkVolume> blocks{};
+
+    // 境界込みの座標 [0, kPaddedChunkSize) → インデックス（x最内、次にz、最外y）
+    static constexpr int Index(int x, int y, int z) {
+        return x + (z + y * kPaddedChunkSize) * kPaddedChunkSize;
+    }
+    // チャンクローカル座標 [-1, kChunkSize] で取得
+    BlockId Get(int x, int y, int z) const { return blocks[Index(x + 1, y + 1, z + 1)]; }
+    void Set(int x, int y, int z, BlockId block) { blocks[Index(x + 1, y + 1, z + 1)] = block; }
+
+    // 中心チャンクと隣接チャンクの境界面から構築（未ロードの近傍は空気）
+    void Build(const ChunkNeighborhood& neighborhood);
+};
+
+} // namespace BoxelGame
\ No newline at end of file
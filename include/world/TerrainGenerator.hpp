@@ -0,0 +1,123 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "world/Chunk.hpp"
+#include "world/ChunkCoord.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/Noise.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace BoxelGame {
+
+struct TerrainSettings {
+    std::uint32_t seed = 0;
+    // 地表の高さ = baseHeight + heightAmplitude × 2Dノイズ
+    float baseHeight = 64.0f;
+    float heightAmplitude = 24.0f;
+    // 3Dノイズで地表を崩す強さ（張り出し・窪み、ブロック単位）
+    float densityAmplitude = 8.0f;
+    int dirtDepth = 3;  // 草の下の土の層の厚さ
+    // 高さマップの範囲から全て空気・全て石と分かるチャンクは3Dノイズを評価せずに埋める
+    bool skipUniformChunks = true;
+    FractalNoiseSettings surface{0, 5, 1.0f / 128.0f, 2.0f, 0.5f};
+    FractalNoiseSettings density{0, 3, 1.0f / 48.0f, 2.0f, 0.5f};
+};
+
+// チャンク列（同じx, zのチャンク）の地表の高さ（3Dノイズによる崩しを含まない）
+// 列ごとに1回だけ求め、その列の全チャンクの生成・空の光・スポーン位置の判定で共有する
+struct ColumnHeightmap {
+    std::array<float, kChunkSize * kChunkSize> heights{};  // x最内、次にz
+    float minHeight = 0.0f;
+    float maxHeight = 0.0f;
+
+    float GetHeight(int localX, int localZ) const { return heights[localX + localZ * kChunkSize]; }
+};
+
+// 高さマップから判定したチャンクの中身
+enum class TerrainChunkClass : std::uint8_t {
+    Air,    // 全て空気
+    Solid,  // 全て石
+    Mixed   // 3Dノイズの評価が必要
+};
+
+// ワールドのシードとチャンク座標のみからチャンクを生成する地形生成器
+// 各チャンクは他のチャンク・生成順・スレッド数に依存せず、同じ入力から常に同じブロック配置になる
+// （ノイズはどの命令セットでもビット単位で同じ値を返し、乱数状態も共有しない）
+// 列の高さマップはキャッシュし、3Dノイズの振れ幅を加えた上下限から地表を含まないチャンクを判定して
+// 空気・石で一様に埋める（結果は全て評価した場合と同じ）
+// const関数は複数スレッドから同時に呼び出し可能。キャッシュを変更する関数はメインスレッドから、
+// 他の呼び出しと重ならないように呼ぶこと
+class TerrainGenerator {
+public:
+    struct Stats {
+        std::uint64_t airChunks = 0;    // 3Dノイズを評価せずに空気で埋めたチャンク
+        std::uint64_t solidChunks = 0;  // 3Dノイズを評価せずに石で埋めたチャンク
+        std::uint64_t noiseChunks = 0;  // 3Dノイズを評価したチャンク
+    };
+
+    TerrainGenerator();
+    explicit TerrainGenerator(const TerrainSettings& settings);
+
+    TerrainGenerator(const TerrainGenerator&) = delete;
+    TerrainGenerator& operator=(const TerrainGenerator&) = delete;
+
+    // キャッシュ済みの列の高さマップを使う（未キャッシュならその場で求め、キャッシュはしない）
+    void GenerateChunk(const ChunkCoord& coord, Chunk& out) const;
+    std::unique_ptr<Chunk> GenerateChunk(const ChunkCoord& coord) const;
+    // 求め済みの列の高さマップから生成する（キャッシュを参照しないため、キャッシュの変更と並行して呼び出し可能）
+    void GenerateChunk(const ChunkCoord& coord, const ColumnHeightmap& column, Chunk& out) const;
+
+    // 未キャッシュの列の高さマップを並列に求めてから、coordsのチャンクをジョブで並列に生成する
+    // （結果はcoordsと同じ順）
+    std::vector<std::unique_ptr<Chunk>> GenerateChunks(JobSystem& jobs, std::span<const ChunkCoord> coords);
+    // 並列に生成してChunkManagerへ登録する（登録は呼び出しスレッドで行う）
+    void GenerateInto(JobSystem& jobs, std::span<const ChunkCoord> coords, ChunkManager& chunks);
+
+    // 列の高さマップ
+    void ComputeColumn(int chunkX, int chunkZ, ColumnHeightmap& out) const;
+    // coordsが含む未キャッシュの列を並列に求めてキャッシュする
+    void PrepareColumns(JobSystem& jobs, std::span<const ChunkCoord> coords);
+    // キャッシュ済みの列（無ければ求めてキャッシュする）
+    const ColumnHeightmap& GetColumn(int chunkX, int chunkZ);
+    const ColumnHeightmap* FindColumn(int chunkX, int chunkZ) const;
+    // 列の全チャンクをアンロードした際などにキャッシュから外す
+    void EvictColumn(int chunkX, int chunkZ);
+    std::size_t GetCachedColumnCount() const { return m_columns.size(); }
+
+    TerrainChunkClass ClassifyChunk(const ChunkCoord& coord, const ColumnHeightmap& column) const;
+    // 地面になり得る最も高いブロックのy（これより上は必ず空気。空の光の初期値に使える）
+    int GetMaxSolidY(const ColumnHeightmap& column) const;
+
+    // 列(x, z)の地表の高さ（3Dノイズによる崩しを含まない、キャッシュ済みの列はキャッシュから）
+    float GetSurfaceHeight(int x, int z) const;
+    // 列(x, z)の最も高い地面ブロックのy（スポーン位置はこの1つ上）
+    int FindTopSolidY(int x, int z) const;
+
+    const TerrainSettings& GetSettings() const { return m_settings; }
+    Stats GetStats() const;
+
+private:
+    TerrainSettings m_settings;
+    // ワールドのシードから導いたノイズごとのシード
+    FractalNoiseSettings m_surface_noise;
+    FractalNoiseSettings m_density_noise;
+    // 3Dノイズによる密度の最大の振れ幅（ブロック単位）
+    float m_density_margin = 0.0f;
+
+    std::unordered_map<std::uint64_t, std::unique_ptr<ColumnHeightmap>> m_columns;  // 詰めた(x, 0, z) → 高さマップ
+
+    mutable std::atomic<std::uint64_t> m_air_chunks{0};
+    mutable std::atomic<std::uint64_t> m_solid_chunks{0};
+    mutable std::atomic<std::uint64_t> m_noise_chunks{0};
+
+    bool IsSolidAt(float height, int x, int y, int z) const;
+};
+
+} // namespace BoxelGame
\ No newline at end of file
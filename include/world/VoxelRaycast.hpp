@@ -0,0 +1,46 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "world/Block.hpp"
+#include "world/ChunkManager.hpp"
+#include <cstdint>
+#include <span>
+
+namespace BoxelGame {
+
+// レイを止めるブロック
+enum class RaycastFilter : std::uint8_t {
+    NonAir,  // 空気以外の全ブロック（ブロック選択）
+    Opaque   // 不透明ブロックのみ（視線・音の遮蔽判定）
+};
+
+// ワールド座標（ブロック単位）のレイ
+struct VoxelRay {
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    float direction[3] = {0.0f, 0.0f, 1.0f};  // 正規化不要（長さ0のレイは何にも当たらない）
+    float maxDistance = 8.0f;                 // これより遠いブロックは調べない
+    RaycastFilter filter = RaycastFilter::NonAir;
+};
+
+struct VoxelRaycastHit {
+    bool hit = false;
+    int block[3] = {0, 0, 0};  // 当たったブロックのワールド座標
+    BlockId blockId = Blocks::Air;
+    // レイが入った面（設置先は block + この面の法線方向）
+    // 始点が当たるブロックの中にある場合は、進行方向の主軸に対して手前側の面
+    BlockFace face = BlockFace::PositiveY;
+    float distance = 0.0f;  // 始点から面に入るまでの距離（始点がブロック内なら0）
+};
+
+// Amanatides-Wooの3D DDAでレイが通るブロックを順に調べ、最初に当たったブロックを返す
+// 走査中のチャンクのポインタを保持し、チャンク境界をまたぐ時のみChunkManagerを検索する
+// （未ロードのチャンクと空気のみのチャンクは中身を読まずに通過する）
+// ChunkManagerが変更されない間は複数スレッドから同時に呼び出し可能
+VoxelRaycastHit RaycastVoxels(const ChunkManager& chunks, const VoxelRay& ray);
+
+// raysをジョブで並列に調べ、結果をoutの同じ位置へ書き込む（全完了まで待機する）
+// 視線・音の遮蔽などtickごとの多数のレイをまとめて処理する（実行中はChunkManagerを変更しないこと）
+void RaycastVoxels(JobSystem& jobs, const ChunkManager& chunks, std::span<const VoxelRay> rays,
+                   std::span<VoxelRaycastHit> out);
+
+} // namespace BoxelGame
\ No newline at end of file
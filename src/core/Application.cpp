@@ -1,17 +1,69 @@
 #include "core/Application.hpp"
+#include "core/Profiler.hpp"
 #include "core/Window.hpp"
+#include "render/RenderBackend.hpp"
 #include <spdlog/spdlog.h>
-#include <glad/gl.h>
+#include <chrono>
+#include <thread>
 
 namespace BoxelGame {
 
-Application::Application() {
+Application::Application()
+    : Application(nullptr) {
+}
+
+Application::Application(std::unique_ptr<IWindow> window, const ApplicationConfig& config)
+    : m_config(config),
+      m_window(std::move(window)),
+      m_timestep(config.tickRate, config.maxTicksPerFrame) {
+    m_tick_input.reserve(InputEventQueue::GetCapacity());
     try {
-        InitializeLogging();
-        InitializeWindow();
+        BOXEL_PROFILE_THREAD("Main");
+        {
+            StartupTrace::Phase phase(&m_startup_trace, "ログ初期化");
+            InitializeLogging();
+        }
+        {
+            StartupTrace::Phase phase(&m_startup_trace, "ジョブシステム初期化");
+            InitializeJobSystem();
+        }
+        if (m_config.streamWorld) {
+            StartupTrace::Phase phase(&m_startup_trace, "ワールド初期化");
+            InitializeWorld();
+        }
         
-        spdlog::info("BoxelGame Application v1.0.0 初期化完了");
+        // GLに依存しない起動タスクをウィンドウ・GLコンテキスト作成と並行して実行する
+        JobCounter startupJobs;
+        StartupFailure startupFailure;
+        ScheduleStartupTasks(startupJobs, startupFailure);
+        {
+            // 例外で抜ける場合もタスク完了を待ってからローカル変数を破棄する
+            struct WaitGuard {
+                JobSystem& jobs;
+                JobCounter& counter;
+                ~WaitGuard() { jobs.Wait(counter); }
+            } waitGuard{*m_job_system, startupJobs};
+            
+            {
+                StartupTrace::Phase phase(&m_startup_trace, "ウィンドウ初期化");
+                InitializeWindow();
+            }
+            {
+                StartupTrace::Phase phase(&m_startup_trace, "描画スレッド起動");
+                InitializeRenderer();
+            }
+            
+            StartupTrace::Phase phase(&m_startup_trace, "起動タスク待機");
+            m_job_system->Wait(startupJobs);
+        }
+        if (startupFailure.failed) {
+            throw InitializationException("起動タスク \"" + startupFailure.task + "\"", startupFailure.reason);
+        }
         
+        m_startup_trace.Finish();
+        spdlog::info("BoxelGame Application v1.0.0 初期化完了");
+        m_startup_trace.LogReport(m_config.startupBudgetSeconds);
+
     } catch (const BoxelGameException&) {
         throw;
     } catch (const std::exception& e) {
@@ -23,52 +75,431 @@ Application::Application() {
 
 Application::~Application() {
     spdlog::info("アプリケーション終了中...");
+    LogFrameStatistics();
+    if (m_frame_allocator) {
+        m_frame_allocator->LogStatistics();
+    }
+    m_render_thread.reset();
+    // 生成ジョブは地形生成器を参照するため、生成器より先に完了を待つ
+    m_streamer.reset();
+    m_terrain.reset();
+    m_meshing.reset();
+    m_job_system.reset();
     m_window.reset();
     spdlog::info("アプリケーション終了完了");
+    LogSystem::Shutdown();
 }
 
 void Application::Run() {
     spdlog::info("アプリケーション実行開始");
     
-    MainLoop();
+    MainLoop(0);
+}
+
+void Application::RunFrames(std::uint64_t frameCount) {
+    spdlog::info("アプリケーション実行開始: {}フレーム", frameCount);
+    
+    if (frameCount > 0) {
+        MainLoop(frameCount);
+    }
 }
 
 void Application::InitializeLogging() {
     try {
-        spdlog::set_level(spdlog::level::info);
-        spdlog::info("ログシステム初期化完了");
+        LogSystem::Initialize(m_config.logging);
+        spdlog::info("ログシステム初期化完了 ({})", m_config.logging.async ? "非同期" : "同期");
     } catch (const std::exception& e) {
         throw InitializationException("Logging", e.what());
     }
 }
 
-void Application::InitializeWindow() {
+void Application::InitializeJobSystem() {
     try {
-        spdlog::info("ウィンドウシステム初期化中...");
-        m_window = std::make_unique<Window>(1280, 720, "BoxelGame - Voxel Sandbox");
-        spdlog::info("ウィンドウシステム初期化完了");
+        spdlog::info("ジョブシステム初期化中...");
+        m_job_system = std::make_unique<JobSystem>(m_config.workerThreadCount);
+        m_frame_allocator = std::make_unique<FrameAllocator>(m_job_system->GetThreadCount(), m_config.frameArenaBytes);
+        m_meshing = std::make_unique<MeshingPipeline>(*m_job_system, m_config.meshJobsInFlight);
     } catch (const std::exception& e) {
-        throw InitializationException("Window", e.what());
+        throw InitializationException("JobSystem", e.what());
     }
 }
 
-void Application::MainLoop() {
+void Application::InitializeWorld() {
+    try {
+        const ChunkStreamingConfig& streaming = m_config.streaming;
+        m_terrain = std::make_unique<TerrainGenerator>(m_config.terrain);
+        m_streamer = std::make_unique<ChunkStreamer>(*m_job_system, *m_terrain, streaming);
+        // メッシュ生成もスポーン地点に近い順に行う
+        m_meshing->SetViewerPosition((static_cast<float>(streaming.spawnChunkX) + 0.5f) * kChunkSize,
+                                     m_config.terrain.baseHeight,
+                                     (static_cast<float>(streaming.spawnChunkZ) + 0.5f) * kChunkSize);
+        spdlog::info("ワールド読み込み: 視野{}チャンク ({}チャンク), 最初のフレームまで半径{}チャンク",
+                     streaming.viewDistance, m_streamer->GetTotalCount(), streaming.firstFrameRadius);
+    } catch (const std::exception& e) {
+        throw InitializationException("World", e.what());
+    }
+}
+
+void Application::InitializeWindow() {
+    if (m_window) {
+        spdlog::info("注入されたウィンドウを使用: {}x{} \"{}\" (GLコンテキスト: {})",
+                     m_window->GetWidth(), m_window->GetHeight(), m_window->GetTitle(),
+                     m_window->HasGraphicsContext() ? "有効" : "無効");
+    } else {
+        try {
+            spdlog::info("ウィンドウシステム初期化中...");
+            m_window = std::make_unique<Window>(1280, 720, "BoxelGame - Voxel Sandbox", &m_startup_trace);
+            spdlog::info("ウィンドウシステム初期化完了");
+        } catch (const std::exception& e) {
+            throw InitializationException("Window", e.what());
+        }
+    }
+    
+    m_window->SetPresentMode(m_config.presentMode);
+}
+
+void Application::ScheduleStartupTasks(JobCounter& counter, StartupFailure& failure) {
+    for (const StartupTask& task : m_config.startupTasks) {
+        if (!task.run) {
+            continue;
+        }
+        m_job_system->Schedule([this, &task, &failure] {
+            StartupTrace::Phase phase(&m_startup_trace, task.name);
+            std::string reason;
+            try {
+                task.run();
+                return;
+            } catch (const std::exception& e) {
+                reason = e.what();
+            } catch (...) {
+                reason = "不明なエラー";
+            }
+            
+            std::lock_guard<std::mutex> lock(failure.mutex);
+            if (!failure.failed) {
+                failure.failed = true;
+                failure.task = task.name;
+                failure.reason = std::move(reason);
+            }
+        }, &counter);
+    }
+    
+    if (!m_config.startupTasks.empty()) {
+        spdlog::info("起動タスク{}件をジョブワーカーで並列実行", m_config.startupTasks.size());
+    }
+}
+
+void Application::InitializeRenderer() {
+    if (!m_config.threadedRendering) {
+        spdlog::info("描画: メインスレッドで直列実行");
+        return;
+    }
+    
+    // GLコンテキストは描画スレッドが所有する（PollEventsはメインスレッドに残す）
+    m_window->DetachContext();
+    try {
+        m_render_thread = std::make_unique<RenderThread>(*m_window, m_config.renderBufferCount);
+    } catch (...) {
+        m_window->MakeContextCurrent();
+        throw;
+    }
+}
+
+void Application::MainLoop(std::uint64_t maxFrames) {
     spdlog::info("メインループ開始");
     
+    // maxFrames == 0 はフレーム数無制限
+    const std::uint64_t startFrame = m_frame_count;
+    const std::uint64_t startTick = m_timestep.GetTickCount();
+    if (m_streamer && !m_streamer->IsFirstFrameReady()) {
+        LoadFirstFrameArea();
+    }
+    auto previousTime = std::chrono::steady_clock::now();
+    
     while (!m_window->ShouldClose()) {
-        m_window->PollEvents();
+        if (maxFrames > 0 && m_frame_count - startFrame >= maxFrames) {
+            break;
+        }
+        
+        const auto currentTime = std::chrono::steady_clock::now();
+        const double frameSeconds = std::chrono::duration<double>(currentTime - previousTime).count();
+        previousTime = currentTime;
+        if (m_frame_count > startFrame) {
+            m_frame_times.Record(frameSeconds);
+        }
+        
+        BOXEL_PROFILE_FRAME();
+        BOXEL_PROFILE_SCOPE("Frame");
+        
+        {
+            BOXEL_PROFILE_SCOPE("PollEvents");
+            m_window->PollEvents();
+        }
         
-        Render();
+        // 固定間隔でシミュレーションを進め、描画は残り時間で補間する
+        const int ticks = m_timestep.Advance(frameSeconds);
+        for (int i = 0; i < ticks; ++i) {
+            Update(m_timestep.GetTickDelta());
+        }
+        UpdateStreaming();
+        UpdateMeshing();
         
-        m_window->SwapBuffers();
+        Render(m_timestep.GetAlpha());
+        RecordStreamingMetrics();
+        
+        // このフレームの一時データを一括解放（フレーム内のジョブはWait済みであること）
+        m_frame_allocator->ResetAll();
+        ++m_frame_count;
+    }
+    
+    // 呼び出し元へ戻る前に提出済みフレームを全て提示する
+    if (m_render_thread) {
+        m_render_thread->Flush();
     }
     
-    spdlog::info("メインループ終了");
+    spdlog::info("メインループ終了: {}フレーム / {}tick (破棄tick累計: {})",
+                 m_frame_count - startFrame, m_timestep.GetTickCount() - startTick,
+                 m_timestep.GetDroppedTickCount());
+    
+    if (!m_config.profileOutputPath.empty()) {
+        ExportProfile(m_config.profileOutputPath, m_config.profileFrameCount);
+    }
+}
+
+LinearArena& Application::GetFrameArena() {
+    // ワーカーではフレームをまたぐジョブ（チャンク生成・メッシュ生成）の実行中にResetAllされ得るため渡さない
+    if (m_job_system->GetCurrentThreadIndex() != 0) {
+        throw BoxelGameException("GetFrameArenaはメインスレッド専用（ジョブはFrameAllocator::ParallelForを使用）");
+    }
+    return m_frame_allocator->GetArena(0);
+}
+
+bool Application::ExportProfile(const std::string& path, std::uint32_t frameCount) const {
+#if BOXEL_PROFILE_ENABLED
+    return Profiler::ExportChromeTrace(path, frameCount);
+#else
+    spdlog::warn("プロファイラが無効なビルドのため出力をスキップ: {} ({}フレーム)", path, frameCount);
+    return false;
+#endif
 }
 
-void Application::Render() {
-    glClearColor(0.1f, 0.2f, 0.4f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+void Application::LogFrameStatistics() const {
+    if (m_frame_times.GetSampleCount() == 0) {
+        return;
+    }
+    
+    // 仕様上の目標: 30 FPS以上（GTX 760 + i5-4690）
+    constexpr double kTargetFps = 30.0;
+    const FrameTimeStatistics stats = m_frame_times.ComputeStatistics();
+    spdlog::info("フレーム時間統計 (直近{}フレーム / 全{}フレーム, 提示モード: {})", stats.sampleCount,
+                 m_frame_times.GetRecordedCount(), GetPresentModeName(m_window->GetPresentMode()));
+    spdlog::info("  min {:.2f}ms / avg {:.2f}ms / p50 {:.2f}ms / p95 {:.2f}ms / p99 {:.2f}ms / max {:.2f}ms",
+                 stats.minMs, stats.averageMs, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs);
+    spdlog::info("  平均 {:.1f} FPS / 1% low {:.1f} FPS (目標{:.0f} FPS: {})",
+                 stats.averageFps, stats.onePercentLowFps, kTargetFps,
+                 stats.onePercentLowFps >= kTargetFps ? "達成" : "未達");
+    
+    if (m_input_latency.GetSampleCount() > 0) {
+        const LatencyStatistics latency = m_input_latency.ComputeStatistics();
+        spdlog::info("入力→シミュレーション遅延 ({}イベント): avg {:.2f}ms / p99 {:.2f}ms / max {:.2f}ms",
+                     latency.sampleCount, latency.averageMs, latency.p99Ms, latency.maxMs);
+    }
+}
+
+void Application::ProcessInput() {
+    BOXEL_PROFILE_SCOPE("Application::ProcessInput");
+    
+    // このtickの入力としてキューを全て取り出す（確保済みバッファを再利用）
+    m_tick_input.clear();
+    const std::uint64_t now = GetInputTimestamp();
+    InputEvent event;
+    while (m_tick_input.size() < m_tick_input.capacity() && m_window->GetInputEvents().TryPop(event)) {
+        m_tick_input.push_back(event);
+        if (now >= event.timestampNs) {
+            m_input_latency.Record(static_cast<double>(now - event.timestampNs) / 1e9);
+        }
+    }
+    m_processed_input_events += m_tick_input.size();
+    
+    // サイズ変更は途中の値を捨て、tick時点の最新値のみを反映する
+    int width = 0;
+    int height = 0;
+    m_window->GetFramebufferSize(width, height);
+    if (width != m_viewport_width || height != m_viewport_height) {
+        m_viewport_width = width;
+        m_viewport_height = height;
+        m_viewport_dirty = true;
+    }
+}
+
+const ChunkMesh* Application::FindChunkMesh(const ChunkCoord& coord, int level) const {
+    if (level < 0 || level > kMaxLodLevel) {
+        return nullptr;
+    }
+    const auto& meshes = m_chunk_meshes[level];
+    const auto it = meshes.find(PackChunkCoord(coord));
+    return it != meshes.end() ? &it->second : nullptr;
+}
+
+void Application::LoadFirstFrameArea() {
+    BOXEL_PROFILE_SCOPE("Application::LoadFirstFrameArea");
+    
+    // 読み込み中もウィンドウイベントは処理し、閉じられたら中断する
+    while (!m_streamer->IsFirstFrameReady() && !m_window->ShouldClose()) {
+        m_window->PollEvents();
+        UpdateStreaming();
+        UpdateMeshing();
+        m_frame_allocator->ResetAll();
+        if (!m_streamer->IsFirstFrameReady() && !m_job_system->RunPendingJob()) {
+            // 生成・メッシュ生成のジョブが全てワーカーで実行中
+            std::this_thread::yield();
+        }
+    }
+}
+
+void Application::UpdateStreaming() {
+    if (!m_streamer) {
+        return;
+    }
+    BOXEL_PROFILE_SCOPE("Application::UpdateStreaming");
+    
+    m_streamed_chunks.clear();
+    m_meshable_chunks.clear();
+    m_streamer->Update(m_chunks, m_streamed_chunks, m_meshable_chunks);
+    if (!m_streamed_chunks.empty()) {
+        m_light.LightNewChunks(*m_job_system, m_streamed_chunks, &GetFrameArena());
+    }
+    // 26近傍が揃ったチャンクのみ要求し、境界の面・AOを作り直さずに済むようにする
+    for (const ChunkCoord& coord : m_meshable_chunks) {
+        m_meshing->Request(coord);
+    }
+}
+
+void Application::UpdateMeshing() {
+    m_completed_meshes.clear();
+    m_meshing->Update(m_chunks, m_completed_meshes);
+    for (CompletedChunkMesh& completed : m_completed_meshes) {
+        if (m_streamer && completed.lodLevel == 0) {
+            m_streamer->NotifyMeshed(completed.coord);
+        }
+        // 空のメッシュも保持する（ブロック変更時にスライス差し替えの起点にする）
+        m_chunk_meshes[completed.lodLevel][PackChunkCoord(completed.coord)] = std::move(completed.mesh);
+    }
+}
+
+void Application::RecordStreamingMetrics() {
+    if (!m_streamer) {
+        return;
+    }
+    
+    if (!m_time_to_first_frame && m_streamer->IsFirstFrameReady()) {
+        m_time_to_first_frame = m_startup_trace.GetElapsedSeconds();
+        spdlog::info("最初のフレーム: {:.3f}秒 (半径{}チャンク, 読み込み済み {}/{}チャンク, 目標{:.1f}秒: {})",
+                     *m_time_to_first_frame, m_config.streaming.firstFrameRadius, m_streamer->GetLoadedCount(),
+                     m_streamer->GetTotalCount(), m_config.startupBudgetSeconds,
+                     *m_time_to_first_frame <= m_config.startupBudgetSeconds ? "達成" : "未達");
+    }
+    if (!m_time_to_full_view && m_streamer->IsComplete()) {
+        m_time_to_full_view = m_startup_trace.GetElapsedSeconds();
+        const TerrainGenerator::Stats stats = m_terrain->GetStats();
+        spdlog::info("視野内の全チャンク読み込み完了: {:.3f}秒 (視野{}チャンク, {}チャンク, ノイズ評価{} / 空気{} / 石{})",
+                     *m_time_to_full_view, m_config.streaming.viewDistance, m_streamer->GetTotalCount(),
+                     stats.noiseChunks, stats.airChunks, stats.solidChunks);
+    }
+}
+
+bool Application::SetBlock(int x, int y, int z, BlockId block) {
+    BOXEL_PROFILE_SCOPE("Application::SetBlock");
+    
+    if (!m_chunks.SetBlock(x, y, z, block)) {
+        return false;
+    }
+    
+    m_light.MarkBlockChanged(x, y, z);
+    
+    const ChunkCoord coord = BlockToChunkCoord(x, y, z);
+    const int local[3] = {BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)};
+    RemeshForBlockEdit(coord, local[0], local[1], local[2]);
+    
+    // チャンク境界のブロックは隣接チャンクの面・AOも変える
+    // AOは斜めの隣接ブロックも参照するため、境界に接する軸の組み合わせごとに辺・角の隣接チャンクも対象とする
+    int directions[3] = {0, 0, 0};
+    for (int axis = 0; axis < 3; ++axis) {
+        directions[axis] = local[axis] == 0 ? -1 : local[axis] == kChunkSize - 1 ? 1 : 0;
+    }
+    for (int mask = 1; mask < 8; ++mask) {
+        ChunkCoord neighbor = coord;
+        int neighborLocal[3] = {local[0], local[1], local[2]};
+        bool valid = true;
+        for (int axis = 0; axis < 3 && valid; ++axis) {
+            if ((mask & (1 << axis)) == 0) {
+                continue;
+            }
+            valid = directions[axis] != 0;
+            (axis == 0 ? neighbor.x : axis == 1 ? neighbor.y : neighbor.z) += directions[axis];
+            neighborLocal[axis] = directions[axis] < 0 ? kChunkSize : -1;
+        }
+        if (valid) {
+            RemeshForBlockEdit(neighbor, neighborLocal[0], neighborLocal[1], neighborLocal[2]);
+        }
+    }
+    return true;
+}
+
+void Application::RemeshForBlockEdit(const ChunkCoord& coord, int x, int y, int z) {
+    if (!m_chunks.Contains(coord)) {
+        return;
+    }
+    
+    auto& meshes = m_chunk_meshes[0];
+    const auto it = meshes.find(PackChunkCoord(coord));
+    if (it == meshes.end()) {
+        m_meshing->Request(coord);
+        return;
+    }
+    
+    // 実行中の非同期生成があっても、版（26近傍を含む）の不一致で破棄・再生成されるため差し替えてよい
+    m_edit_mesher.RemeshAroundBlock(m_chunks.GetNeighborhood(coord), x, y, z, it->second);
+    ++m_incremental_remeshes;
+}
+
+void Application::Update(double /*deltaSeconds*/) {
+    BOXEL_PROFILE_SCOPE("Application::Update");
+    
+    ProcessInput();
+    
+    // 直前のtick以降のブロック変更による光量の変化を1回の伝播で反映する
+    m_light.Update();
+    
+    // シミュレーション更新（物理・AI等は固定間隔のここで処理する）
+}
+
+void Application::Render(float alpha) {
+    BOXEL_PROFILE_SCOPE("Application::Render");
+    
+    if (m_render_thread) {
+        RenderCommandList& commands = m_render_thread->BeginFrame(m_frame_count, alpha);
+        RecordRenderCommands(commands);
+        m_render_thread->SubmitFrame();
+        return;
+    }
+    
+    m_render_commands.Reset(m_frame_count, alpha);
+    RecordRenderCommands(m_render_commands);
+    // ヘッドレス実行時はGL呼び出しを行わない
+    if (m_window->HasGraphicsContext()) {
+        RenderBackend::Execute(m_render_commands);
+    }
+    m_window->SwapBuffers();
+}
+
+void Application::RecordRenderCommands(RenderCommandList& commands) {
+    if (m_viewport_dirty) {
+        commands.SetViewport(0, 0, m_viewport_width, m_viewport_height);
+        m_viewport_dirty = false;
+    }
+    
+    commands.Clear(0.1f, 0.2f, 0.4f, 1.0f);
 }
 
 } // namespace BoxelGame
\ No newline at end of file
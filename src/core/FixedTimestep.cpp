@@ -0,0 +1,40 @@
+#include "core/FixedTimestep.hpp"
+#include "core/Exception.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace BoxelGame {
+
+FixedTimestep::FixedTimestep(double tickRate, int maxTicksPerFrame)
+    : m_tick_delta(0.0), m_max_ticks_per_frame(maxTicksPerFrame) {
+    if (tickRate <= 0.0 || maxTicksPerFrame <= 0) {
+        throw BoxelGameException("FixedTimestep: tickRateとmaxTicksPerFrameは正の値である必要があります");
+    }
+    m_tick_delta = 1.0 / tickRate;
+}
+
+int FixedTimestep::Advance(double frameSeconds) {
+    // 時計の巻き戻り等による負の経過時間は無視
+    if (frameSeconds > 0.0) {
+        m_accumulator += frameSeconds;
+    }
+    
+    const double pending = std::floor(m_accumulator / m_tick_delta);
+    int ticks = static_cast<int>(std::min(pending, static_cast<double>(m_max_ticks_per_frame)));
+    m_accumulator -= ticks * m_tick_delta;
+    
+    // 上限を超えた分は破棄し、シミュレーションを実時間から遅らせる（描画側が劣化する）
+    if (pending > ticks) {
+        m_dropped_ticks += static_cast<std::uint64_t>(pending) - static_cast<std::uint64_t>(ticks);
+        m_accumulator = std::fmod(m_accumulator, m_tick_delta);
+    }
+    
+    m_tick_count += static_cast<std::uint64_t>(ticks);
+    return ticks;
+}
+
+float FixedTimestep::GetAlpha() const {
+    return static_cast<float>(m_accumulator / m_tick_delta);
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "core/FrameAllocator.hpp"
+#include "core/Exception.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <new>
+
+namespace BoxelGame {
+
+namespace {
+
+// キャッシュライン境界に揃えてスレッド間の偽共有を避ける
+constexpr std::size_t kArenaAlignment = 64;
+
+} // namespace
+
+LinearArena::LinearArena(std::size_t capacity)
+    : m_buffer(static_cast<std::byte*>(::operator new(capacity, std::align_val_t{kArenaAlignment}))),
+      m_capacity(capacity) {
+    m_overflow_blocks.reserve(16);
+}
+
+LinearArena::~LinearArena() {
+    Reset();
+    ::operator delete(m_buffer, m_capacity, std::align_val_t{kArenaAlignment});
+}
+
+void LinearArena::Reset() {
+    m_last_frame_bytes = GetUsedBytes();
+    m_high_water_mark = std::max(m_high_water_mark, m_last_frame_bytes);
+    
+    for (const OverflowBlock& block : m_overflow_blocks) {
+        ::operator delete(block.pointer, block.bytes, std::align_val_t{block.alignment});
+    }
+    m_overflow_blocks.clear();
+    m_overflow_bytes = 0;
+    m_offset = 0;
+}
+
+void* LinearArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_buffer);
+    const std::uintptr_t aligned = (base + m_offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t newOffset = static_cast<std::size_t>(aligned - base) + bytes;
+    
+    if (newOffset <= m_capacity) {
+        m_offset = newOffset;
+        return reinterpret_cast<void*>(aligned);
+    }
+    
+    // 容量超過時は通常のヒープ確保へ退避（正しさを優先し、超過はピーク値で検出する）
+    void* pointer = ::operator new(bytes, std::align_val_t{alignment});
+    m_overflow_blocks.push_back({pointer, bytes, alignment});
+    m_overflow_bytes += bytes;
+    ++m_overflow_count;
+    return pointer;
+}
+
+void LinearArena::do_deallocate(void* /*pointer*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    // 個別解放は行わない（Resetで一括解放）
+}
+
+bool LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+FrameAllocator::FrameAllocator(unsigned threadCount, std::size_t bytesPerThread) {
+    if (threadCount == 0 || bytesPerThread == 0) {
+        throw InitializationException("FrameAllocator", "スレッド数とアリーナ容量は1以上を指定");
+    }
+    
+    m_arenas.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        m_arenas.push_back(std::make_unique<LinearArena>(bytesPerThread));
+    }
+}
+
+void FrameAllocator::ParallelFor(JobSystem& jobs, std::size_t count, std::size_t grainSize,
+                                 const std::function<void(std::size_t, std::size_t, LinearArena&)>& body) {
+    // 分割ジョブは呼び出しスレッド（Wait中）とワーカーでのみ実行されるため、スレッド番号は常に有効
+    if (jobs.GetCurrentThreadIndex() < 0 || jobs.GetThreadCount() > m_arenas.size()) {
+        throw BoxelGameException("フレームアロケータの並列処理はJobSystemのスレッドから、アリーナ数以下のスレッド数で呼ぶこと");
+    }
+    
+    m_active_parallel.fetch_add(1, std::memory_order_relaxed);
+    jobs.ParallelFor(count, grainSize, [&](std::size_t begin, std::size_t end) {
+        const int threadIndex = jobs.GetCurrentThreadIndex();
+        body(begin, end, *m_arenas[static_cast<std::size_t>(threadIndex)]);
+    });
+    m_active_parallel.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FrameAllocator::ResetAll() {
+    if (m_active_parallel.load(std::memory_order_relaxed) != 0) {
+        throw BoxelGameException("ParallelFor実行中はフレームアリーナを解放できません");
+    }
+    
+    std::size_t total = 0;
+    for (const auto& arena : m_arenas) {
+        arena->Reset();
+        total += arena->GetLastFrameBytes();
+    }
+    m_last_frame_bytes = total;
+    m_high_water_mark = std::max(m_high_water_mark, total);
+    ++m_frame_count;
+}
+
+void FrameAllocator::LogStatistics() const {
+    if (m_frame_count == 0) {
+        return;
+    }
+    
+    spdlog::info("フレームアロケータ統計 ({}フレーム): 合計ピーク {:.1f}KiB", m_frame_count,
+                 static_cast<double>(m_high_water_mark) / 1024.0);
+    for (std::size_t i = 0; i < m_arenas.size(); ++i) {
+        const LinearArena& arena = *m_arenas[i];
+        if (arena.GetOverflowCount() > 0) {
+            spdlog::warn("  スレッド{}: ピーク {:.1f}KiB / 容量 {:.1f}KiB (容量超過 {}回、容量の拡大を推奨)", i,
+                         static_cast<double>(arena.GetHighWaterMark()) / 1024.0,
+                         static_cast<double>(arena.GetCapacity()) / 1024.0, arena.GetOverflowCount());
+        } else {
+            spdlog::info("  スレッド{}: ピーク {:.1f}KiB / 容量 {:.1f}KiB", i,
+                         static_cast<double>(arena.GetHighWaterMark()) / 1024.0,
+                         static_cast<double>(arena.GetCapacity()) / 1024.0);
+        }
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
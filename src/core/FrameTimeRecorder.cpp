@@ -0,0 +1,65 @@
+#include "core/FrameTimeRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace BoxelGame {
+
+namespace {
+
+// ソート済み配列からの最近傍順位パーセンタイル
+double Percentile(const std::vector<double>& sorted, double percentile) {
+    const double rank = std::ceil(percentile / 100.0 * static_cast<double>(sorted.size()));
+    const std::size_t index = static_cast<std::size_t>(std::max(rank, 1.0)) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+} // namespace
+
+FrameTimeRecorder::FrameTimeRecorder(std::size_t capacity)
+    : m_samples(std::max<std::size_t>(capacity, 1)) {
+}
+
+void FrameTimeRecorder::Record(double frameSeconds) {
+    m_samples[m_next] = frameSeconds * 1000.0;
+    m_next = m_next + 1 == m_samples.size() ? 0 : m_next + 1;
+    m_count = std::min(m_count + 1, m_samples.size());
+    ++m_recorded;
+}
+
+void FrameTimeRecorder::Reset() {
+    m_next = 0;
+    m_count = 0;
+    m_recorded = 0;
+}
+
+FrameTimeStatistics FrameTimeRecorder::ComputeStatistics() const {
+    FrameTimeStatistics stats;
+    if (m_count == 0) {
+        return stats;
+    }
+    
+    // 保持中のフレームは、満杯になるまでは先頭から、満杯後は全体（順序は統計に影響しない）
+    std::vector<double> sorted(m_samples.begin(), m_samples.begin() + static_cast<std::ptrdiff_t>(m_count));
+    std::sort(sorted.begin(), sorted.end());
+    
+    const double total = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+    stats.sampleCount = sorted.size();
+    stats.minMs = sorted.front();
+    stats.maxMs = sorted.back();
+    stats.averageMs = total / static_cast<double>(sorted.size());
+    stats.p50Ms = Percentile(sorted, 50.0);
+    stats.p95Ms = Percentile(sorted, 95.0);
+    stats.p99Ms = Percentile(sorted, 99.0);
+    stats.averageFps = stats.averageMs > 0.0 ? 1000.0 / stats.averageMs : 0.0;
+    
+    // 1% low: 最も遅い1%（最低1フレーム）の平均フレーム時間をFPSに換算
+    const std::size_t slowCount = std::max<std::size_t>(sorted.size() / 100, 1);
+    const double slowTotal = std::accumulate(sorted.end() - static_cast<std::ptrdiff_t>(slowCount), sorted.end(), 0.0);
+    const double slowAverageMs = slowTotal / static_cast<double>(slowCount);
+    stats.onePercentLowFps = slowAverageMs > 0.0 ? 1000.0 / slowAverageMs : 0.0;
+    
+    return stats;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
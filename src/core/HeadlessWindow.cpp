@@ -0,0 +1,16 @@
+#include "core/HeadlessWindow.hpp"
+#include <spdlog/spdlog.h>
+
+namespace BoxelGame {
+
+HeadlessWindow::HeadlessWindow(int width, int height, const std::string& title)
+    : m_width(width), m_height(height), m_title(title) {
+    spdlog::info("ヘッドレスウィンドウ作成: {}x{} \"{}\"", width, height, title);
+}
+
+void HeadlessWindow::GetFramebufferSize(int& width, int& height) const {
+    width = m_width;
+    height = m_height;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "core/JobSystem.hpp"
+#include "core/Profiler.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <exception>
+#include <string>
+
+namespace BoxelGame {
+
+struct Job {
+    JobFunction function;
+    JobCounter* counter;
+};
+
+namespace {
+
+// 各ワーカーのキュー容量（超過分は投入スレッドで即時実行）
+constexpr std::size_t kQueueCapacity = 4096;
+// 休眠前にジョブを探索する回数
+constexpr int kSpinCount = 64;
+
+// 呼び出しスレッドが所属するJobSystemとスレッド番号
+thread_local const JobSystem* t_owner = nullptr;
+thread_local int t_thread_index = -1;
+
+// 盗み先選択用の軽量乱数（xorshift32）
+std::uint32_t NextRandom() {
+    thread_local std::uint32_t state = 0x9E3779B9u ^ static_cast<std::uint32_t>(
+        std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace
+
+JobCounter::~JobCounter() {
+    // 完了処理中のスレッドがロックを解放するまで待ってから破棄する
+    std::lock_guard lock(m_mutex);
+    
+    // 依存先が完了しないまま破棄された継続ジョブは実行されない
+    for (Job* job : m_continuations) {
+        delete job;
+    }
+}
+
+JobSystem::JobSystem(unsigned workerCount) {
+    if (workerCount == 0) {
+        workerCount = DefaultWorkerCount();
+    }
+    
+    for (unsigned i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkStealingDeque<Job>>(kQueueCapacity));
+    }
+    
+    // 生成スレッドをメインスレッド（番号0）として登録
+    if (t_owner == nullptr) {
+        t_owner = this;
+        t_thread_index = 0;
+    }
+    
+    m_workers.reserve(workerCount);
+    for (unsigned i = 1; i <= workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+    
+    spdlog::info("ジョブシステム初期化完了: ワーカー{}スレッド", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(m_sleep_mutex);
+        m_stopping.store(true);
+    }
+    m_wake.notify_all();
+    
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    
+    // 残ったジョブは破棄せず実行して依存関係を解決する
+    while (Job* job = TryGetJob(GetCurrentThreadIndex())) {
+        Execute(job);
+    }
+    
+    if (t_owner == this) {
+        t_owner = nullptr;
+        t_thread_index = -1;
+    }
+}
+
+unsigned JobSystem::DefaultWorkerCount() {
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+}
+
+int JobSystem::GetCurrentThreadIndex() const {
+    return t_owner == this ? t_thread_index : -1;
+}
+
+void JobSystem::Schedule(JobFunction function, JobCounter* counter) {
+    if (counter) {
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+    Enqueue(new Job{std::move(function), counter});
+}
+
+void JobSystem::ScheduleAfter(JobCounter& dependency, JobFunction function, JobCounter* counter) {
+    if (counter) {
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto* job = new Job{std::move(function), counter};
+    
+    {
+        // Finish側も同じロック内で継続リストを取り出すため、取りこぼしは起きない
+        std::lock_guard lock(dependency.m_mutex);
+        if (!dependency.IsDone()) {
+            dependency.m_continuations.push_back(job);
+            return;
+        }
+    }
+    Enqueue(job);
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    BOXEL_PROFILE_SCOPE("JobSystem::Wait");
+    const int threadIndex = GetCurrentThreadIndex();
+    while (!counter.IsDone()) {
+        if (Job* job = TryGetJob(threadIndex)) {
+            Execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::RunPendingJob() {
+    Job* job = TryGetJob(GetCurrentThreadIndex());
+    if (!job) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+void JobSystem::ParallelFor(std::size_t count, std::size_t grainSize,
+                            const std::function<void(std::size_t, std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    grainSize = std::max<std::size_t>(grainSize, 1);
+    
+    JobCounter counter;
+    for (std::size_t begin = 0; begin < count; begin += grainSize) {
+        const std::size_t end = std::min(begin + grainSize, count);
+        Schedule([&body, begin, end]() { body(begin, end); }, &counter);
+    }
+    Wait(counter);
+}
+
+void JobSystem::WorkerLoop(unsigned threadIndex) {
+    t_owner = this;
+    t_thread_index = static_cast<int>(threadIndex);
+    BOXEL_PROFILE_THREAD("Worker " + std::to_string(threadIndex));
+    
+    const int index = static_cast<int>(threadIndex);
+    int idleSpins = 0;
+    while (true) {
+        if (Job* job = TryGetJob(index)) {
+            idleSpins = 0;
+            Execute(job);
+            continue;
+        }
+        
+        if (++idleSpins < kSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        idleSpins = 0;
+        
+        // 休眠: m_sleepingの加算とm_pendingの確認はEnqueue側と逆順のため起床漏れは起きない
+        std::unique_lock lock(m_sleep_mutex);
+        m_sleeping.fetch_add(1);
+        m_wake.wait(lock, [this]() { return m_stopping.load() || m_pending.load() > 0; });
+        m_sleeping.fetch_sub(1);
+        if (m_stopping.load() && m_pending.load() == 0) {
+            return;
+        }
+    }
+}
+
+void JobSystem::Enqueue(Job* job) {
+    const int threadIndex = GetCurrentThreadIndex();
+    if (threadIndex >= 0) {
+        if (!m_queues[static_cast<std::size_t>(threadIndex)]->Push(job)) {
+            // キュー満杯時は投入スレッドで即時実行
+            Execute(job);
+            return;
+        }
+    } else {
+        std::lock_guard lock(m_injection_mutex);
+        m_injection_queue.push_back(job);
+    }
+    
+    m_pending.fetch_add(1);
+    if (m_sleeping.load() > 0) {
+        WakeWorkers(1);
+    }
+}
+
+Job* JobSystem::TryGetJob(int threadIndex) {
+    Job* job = nullptr;
+    
+    // 1. 自スレッドのキュー（LIFO: キャッシュ局所性重視）
+    if (threadIndex >= 0) {
+        job = m_queues[static_cast<std::size_t>(threadIndex)]->Pop();
+    }
+    
+    // 2. 外部スレッドからの投入キュー
+    if (!job) {
+        std::unique_lock lock(m_injection_mutex, std::try_to_lock);
+        if (lock.owns_lock() && !m_injection_queue.empty()) {
+            job = m_injection_queue.front();
+            m_injection_queue.pop_front();
+        }
+    }
+    
+    // 3. 他スレッドのキューから盗む（FIFO: 大きな粒度のジョブを優先）
+    if (!job) {
+        const std::size_t queueCount = m_queues.size();
+        const std::size_t start = NextRandom() % queueCount;
+        for (std::size_t i = 0; i < queueCount && !job; ++i) {
+            const std::size_t victim = (start + i) % queueCount;
+            if (static_cast<int>(victim) != threadIndex) {
+                job = m_queues[victim]->Steal();
+            }
+        }
+    }
+    
+    if (job) {
+        m_pending.fetch_sub(1);
+    }
+    return job;
+}
+
+void JobSystem::Execute(Job* job) {
+    try {
+        job->function();
+    } catch (const std::exception& e) {
+        spdlog::error("ジョブ実行中に例外が発生: {}", e.what());
+    } catch (...) {
+        spdlog::error("ジョブ実行中に不明な例外が発生");
+    }
+    
+    JobCounter* counter = job->counter;
+    delete job;
+    Finish(counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+    
+    // 最後の1つ以外はロック無しで減算
+    int value = counter->m_value.load(std::memory_order_relaxed);
+    while (value > 1) {
+        if (counter->m_value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+    
+    // 0への遷移と継続ジョブの取り出しはロック内で行う（ScheduleAfter・~JobCounterと排他）
+    std::vector<Job*> continuations;
+    {
+        std::lock_guard lock(counter->m_mutex);
+        if (counter->m_value.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        continuations.swap(counter->m_continuations);
+    }
+    
+    for (Job* continuation : continuations) {
+        Enqueue(continuation);
+    }
+}
+
+void JobSystem::WakeWorkers(int count) {
+    std::lock_guard lock(m_sleep_mutex);
+    if (count == 1) {
+        m_wake.notify_one();
+    } else {
+        m_wake.notify_all();
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
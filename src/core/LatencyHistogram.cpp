@@ -0,0 +1,59 @@
+#include "core/LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace BoxelGame {
+
+void LatencyHistogram::Record(double latencySeconds) {
+    const double ms = std::max(latencySeconds * 1000.0, 0.0);
+    const auto bucket = static_cast<std::size_t>(std::min(ms / kBucketWidthMs, static_cast<double>(kBucketCount - 1)));
+    ++m_buckets[bucket];
+    
+    m_min_ms = m_count == 0 ? ms : std::min(m_min_ms, ms);
+    m_max_ms = m_count == 0 ? ms : std::max(m_max_ms, ms);
+    m_total_ms += ms;
+    ++m_count;
+}
+
+void LatencyHistogram::Reset() {
+    m_buckets.fill(0);
+    m_count = 0;
+    m_total_ms = 0.0;
+    m_min_ms = 0.0;
+    m_max_ms = 0.0;
+}
+
+LatencyStatistics LatencyHistogram::ComputeStatistics() const {
+    LatencyStatistics stats;
+    if (m_count == 0) {
+        return stats;
+    }
+    
+    stats.sampleCount = m_count;
+    stats.minMs = m_min_ms;
+    stats.maxMs = m_max_ms;
+    stats.averageMs = m_total_ms / static_cast<double>(m_count);
+    stats.p50Ms = Percentile(50.0);
+    stats.p95Ms = Percentile(95.0);
+    stats.p99Ms = Percentile(99.0);
+    return stats;
+}
+
+double LatencyHistogram::Percentile(double percentile) const {
+    // 最近傍順位の標本を含む区間の上端（実測の範囲に収める）
+    const double rank = std::ceil(percentile / 100.0 * static_cast<double>(m_count));
+    const auto target = std::max<std::uint64_t>(static_cast<std::uint64_t>(rank), 1);
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        cumulative += m_buckets[i];
+        if (cumulative >= target) {
+            if (i == kBucketCount - 1) {
+                return m_max_ms;
+            }
+            return std::clamp(static_cast<double>(i + 1) * kBucketWidthMs, m_min_ms, m_max_ms);
+        }
+    }
+    return m_max_ms;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
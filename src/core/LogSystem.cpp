@@ -0,0 +1,268 @@
+#include "core/LogSystem.hpp"
+#include "core/Exception.hpp"
+#include "core/MpmcQueue.hpp"
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+
+namespace {
+
+constexpr std::size_t kMaxLoggerNameLength = 32;
+constexpr std::size_t kMaxPayloadLength = 320;
+
+// キューに積む固定長ログレコード（超過分は切り詰める）
+struct LogRecord {
+    spdlog::log_clock::time_point time;
+    spdlog::source_loc source;
+    std::size_t threadId = 0;
+    spdlog::level::level_enum level = spdlog::level::info;
+    std::uint16_t nameLength = 0;
+    std::uint16_t payloadLength = 0;
+    std::array<char, kMaxLoggerNameLength> name;
+    std::array<char, kMaxPayloadLength> payload;
+};
+
+std::uint16_t CopyTruncated(spdlog::string_view_t source, char* destination, std::size_t capacity) {
+    const std::size_t length = std::min(source.size(), capacity);
+    std::memcpy(destination, source.data(), length);
+    return static_cast<std::uint16_t>(length);
+}
+
+// 呼び出しスレッドはレコードをキューへ積むだけで、出力は専用スレッドが行うシンク
+class AsyncQueueSink final : public spdlog::sinks::sink {
+public:
+    AsyncQueueSink(const LoggingConfig& config, std::shared_ptr<spdlog::sinks::sink> backend)
+        : m_queue(std::make_unique<MpmcQueue<LogRecord>>(config.queueCapacity)),
+          m_policy(config.overflowPolicy),
+          m_backend(std::move(backend)),
+          m_writer(&AsyncQueueSink::WriterLoop, this) {}
+
+    ~AsyncQueueSink() override {
+        Stop();
+    }
+
+    void log(const spdlog::details::log_msg& msg) override {
+        // 停止後（シャットダウン中の残りのログ）は同期出力
+        // 投入中の数を先に増やし、Stopがキューを解放する前に投入を終えられるようにする
+        m_producers.fetch_add(1);
+        if (m_stopped.load()) {
+            m_producers.fetch_sub(1, std::memory_order_release);
+            m_backend->log(msg);
+            return;
+        }
+        
+        LogRecord record;
+        record.time = msg.time;
+        record.source = msg.source;
+        record.threadId = msg.thread_id;
+        record.level = msg.level;
+        record.nameLength = CopyTruncated(msg.logger_name, record.name.data(), record.name.size());
+        record.payloadLength = CopyTruncated(msg.payload, record.payload.data(), record.payload.size());
+        
+        while (!m_queue->TryPush(record)) {
+            if (m_policy == LogOverflowPolicy::DropNewest) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                m_producers.fetch_sub(1, std::memory_order_release);
+                return;
+            }
+            Signal();
+            std::this_thread::yield();
+        }
+        Signal();
+        m_producers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void flush() override {
+        m_flush_requested.store(true, std::memory_order_release);
+        Signal();
+    }
+
+    void set_pattern(const std::string& pattern) override {
+        m_backend->set_pattern(pattern);
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override {
+        m_backend->set_formatter(std::move(formatter));
+    }
+
+    // 書き込みスレッドを止めてキューを出力し切り、キューを解放する
+    // 差し替えたロガーは他スレッドが参照中の可能性があるため残すが、停止後のシンクは固定長キューを持たない
+    void Stop() {
+        if (m_stopped.exchange(true)) {
+            return;
+        }
+        // 停止前に投入を始めた呼び出しの完了を待つ（Blockポリシーでも書き込みスレッドが空きを作る）
+        while (m_producers.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+        m_stopping.store(true, std::memory_order_release);
+        Signal();
+        m_writer.join();
+        
+        // 停止と競合して積まれたレコードを出力
+        if (DrainQueue()) {
+            m_backend->flush();
+        }
+        m_queue.reset();
+    }
+
+    std::uint64_t GetDroppedCount() const {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<MpmcQueue<LogRecord>> m_queue;  // 停止後は解放する
+    LogOverflowPolicy m_policy;
+    std::shared_ptr<spdlog::sinks::sink> m_backend;
+    std::atomic<std::uint32_t> m_signal{0};
+    std::atomic<bool> m_flush_requested{false};
+    std::atomic<bool> m_stopping{false};
+    std::atomic<bool> m_stopped{false};
+    std::atomic<std::uint32_t> m_producers{0};  // キューへ投入中の呼び出し数
+    std::atomic<std::uint64_t> m_dropped{0};
+    LogRecord m_record;    // 取り出し用（書き込みスレッド、停止後は停止スレッドのみが使用）
+    std::thread m_writer;  // 他メンバの初期化後に起動するため最後に宣言
+
+    void Signal() {
+        m_signal.fetch_add(1, std::memory_order_release);
+        m_signal.notify_one();
+    }
+
+    bool DrainQueue() {
+        bool wrote = false;
+        while (m_queue->TryPop(m_record)) {
+            spdlog::details::log_msg msg(m_record.time, m_record.source,
+                                         spdlog::string_view_t(m_record.name.data(), m_record.nameLength),
+                                         m_record.level,
+                                         spdlog::string_view_t(m_record.payload.data(), m_record.payloadLength));
+            msg.thread_id = m_record.threadId;
+            m_backend->log(msg);
+            wrote = true;
+        }
+        return wrote;
+    }
+
+    void WriterLoop() {
+        std::uint64_t reportedDrops = 0;
+        while (true) {
+            // 取り出し前に通知値を読んでおくことで、取り出し後の投入を取りこぼさない
+            const std::uint32_t observed = m_signal.load(std::memory_order_acquire);
+            const bool stopping = m_stopping.load(std::memory_order_acquire);
+            
+            bool wrote = DrainQueue();
+            
+            const std::uint64_t drops = m_dropped.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                const std::string warning = "非同期ログキュー満杯のため" + std::to_string(drops - reportedDrops) + "件のログを破棄";
+                m_backend->log(spdlog::details::log_msg(spdlog::string_view_t(), spdlog::level::warn,
+                                                         spdlog::string_view_t(warning.data(), warning.size())));
+                reportedDrops = drops;
+                wrote = true;
+            }
+            
+            if (wrote || m_flush_requested.exchange(false, std::memory_order_acq_rel)) {
+                m_backend->flush();
+            }
+            if (stopping) {
+                return;
+            }
+            m_signal.wait(observed, std::memory_order_acquire);
+        }
+    }
+};
+
+struct LogState {
+    std::mutex mutex;
+    std::shared_ptr<spdlog::sinks::sink> consoleSink;
+    std::shared_ptr<AsyncQueueSink> asyncSink;
+    // 他スレッドがdefault_logger_raw()経由で参照中の可能性があるため、差し替えたロガーは破棄しない
+    // （停止したシンクはキューを解放済みのため、1件あたりはロガーとシンクの小さなオブジェクトのみ）
+    std::vector<std::shared_ptr<spdlog::logger>> retiredLoggers;
+};
+
+LogState& GetLogState() {
+    static LogState state;
+    return state;
+}
+
+void InstallDefaultLogger(LogState& state, std::shared_ptr<spdlog::logger> logger) {
+    if (auto previous = spdlog::default_logger()) {
+        state.retiredLoggers.push_back(std::move(previous));
+    }
+    spdlog::set_default_logger(std::move(logger));
+}
+
+void ShutdownLocked(LogState& state) {
+    if (!state.asyncSink) {
+        return;
+    }
+    
+    // 先に同期ロガーへ切り替えてから、キューに残ったログを出力し切る
+    auto syncLogger = std::make_shared<spdlog::logger>("", state.consoleSink);
+    syncLogger->set_level(spdlog::default_logger_raw()->level());
+    InstallDefaultLogger(state, std::move(syncLogger));
+    
+    state.asyncSink->Stop();
+    state.asyncSink.reset();
+}
+
+} // namespace
+
+void LogSystem::Initialize(const LoggingConfig& config) {
+    // キューはインデックスをマスクで折り返すため容量は2以上の2のべき乗に限る（失敗時は既存のロガーを残す）
+    if (config.async && (config.queueCapacity < 2 || !std::has_single_bit(config.queueCapacity))) {
+        throw InitializationException("LogSystem",
+                                      "非同期キュー容量は2以上の2のべき乗を指定: " + std::to_string(config.queueCapacity));
+    }
+    
+    LogState& state = GetLogState();
+    std::lock_guard lock(state.mutex);
+    ShutdownLocked(state);
+    
+    if (!state.consoleSink) {
+        state.consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    }
+    
+    std::shared_ptr<spdlog::logger> logger;
+    if (config.async) {
+        state.asyncSink = std::make_shared<AsyncQueueSink>(config, state.consoleSink);
+        logger = std::make_shared<spdlog::logger>("", state.asyncSink);
+    } else {
+        logger = std::make_shared<spdlog::logger>("", state.consoleSink);
+    }
+    logger->set_level(config.level);
+    logger->flush_on(spdlog::level::err);
+    InstallDefaultLogger(state, std::move(logger));
+}
+
+void LogSystem::Shutdown() {
+    LogState& state = GetLogState();
+    std::lock_guard lock(state.mutex);
+    ShutdownLocked(state);
+}
+
+bool LogSystem::IsAsync() {
+    LogState& state = GetLogState();
+    std::lock_guard lock(state.mutex);
+    return state.asyncSink != nullptr;
+}
+
+std::uint64_t LogSystem::GetDroppedMessageCount() {
+    LogState& state = GetLogState();
+    std::lock_guard lock(state.mutex);
+    return state.asyncSink ? state.asyncSink->GetDroppedCount() : 0;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "core/Profiler.hpp"
+#include <spdlog/spdlog.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace BoxelGame {
+
+namespace {
+
+// スレッドあたりのゾーン保持数（2のべき乗）
+constexpr std::uint64_t kZoneCapacity = 1u << 14;
+// フレーム開始時刻の保持数
+constexpr std::uint64_t kFrameHistory = 1024;
+
+struct ZoneRecord {
+    const char* name;
+    std::uint64_t startNs;
+    std::uint64_t endNs;
+    std::uint32_t depth;
+};
+
+// スレッド専用リングバッファ（所有スレッドのみが書き込み、エクスポート側は読み取りのみ）
+struct ThreadBuffer {
+    std::array<ZoneRecord, kZoneCapacity> records{};
+    std::atomic<std::uint64_t> head{0};
+    std::uint32_t threadId = 0;
+    std::uint32_t depth = 0;  // 所有スレッドのみがアクセス
+    std::string name;         // Registry::mutexで保護
+    bool retired = false;     // 所有スレッドが終了した（Registry::mutexで保護）
+};
+
+struct Registry {
+    std::mutex mutex;
+    // 終了したスレッドのバッファは次に登録されたスレッドが再利用するため、数は同時に存在したスレッド数で頭打ちになる
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::uint32_t nextThreadId = 0;
+    std::array<std::atomic<std::uint64_t>, kFrameHistory> frameStarts{};
+    std::atomic<std::uint64_t> frameIndex{0};
+    std::atomic<std::uint64_t> resetTime{0};
+    const std::uint64_t epoch = Profiler::Now();
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+// スレッド終了時にバッファを再利用可能にする
+// 終了したスレッドの記録は、別のスレッドがバッファを再利用するまではエクスポートできる
+struct ThreadBufferOwner {
+    ThreadBuffer* buffer = nullptr;
+
+    ~ThreadBufferOwner() {
+        if (buffer) {
+            std::lock_guard lock(GetRegistry().mutex);
+            buffer->retired = true;
+        }
+    }
+};
+
+// 呼び出しスレッドのバッファを取得（初回のみ登録のためロックを取る）
+ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBufferOwner owner;
+    if (!owner.buffer) {
+        Registry& registry = GetRegistry();
+        std::unique_ptr<ThreadBuffer> created;
+        std::lock_guard lock(registry.mutex);
+        const auto retired = std::find_if(registry.buffers.begin(), registry.buffers.end(),
+                                          [](const auto& buffer) { return buffer->retired; });
+        if (retired != registry.buffers.end()) {
+            owner.buffer = retired->get();
+            owner.buffer->head.store(0, std::memory_order_release);
+            owner.buffer->depth = 0;
+            owner.buffer->retired = false;
+        } else {
+            created = std::make_unique<ThreadBuffer>();
+            owner.buffer = created.get();
+            registry.buffers.push_back(std::move(created));
+        }
+        owner.buffer->threadId = registry.nextThreadId++;
+        owner.buffer->name = fmt::format("Thread {}", owner.buffer->threadId);
+    }
+    return *owner.buffer;
+}
+
+void AppendJsonEscaped(std::string& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            default: out += *c; break;
+        }
+    }
+}
+
+} // namespace
+
+std::uint64_t Profiler::Now() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::MarkFrame() {
+    Registry& registry = GetRegistry();
+    const std::uint64_t frame = registry.frameIndex.load(std::memory_order_relaxed) + 1;
+    registry.frameStarts[frame % kFrameHistory].store(Now(), std::memory_order_relaxed);
+    registry.frameIndex.store(frame, std::memory_order_release);
+}
+
+std::uint64_t Profiler::GetFrameIndex() {
+    return GetRegistry().frameIndex.load(std::memory_order_acquire);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard lock(GetRegistry().mutex);
+    buffer.name = name;
+}
+
+void Profiler::RecordZone(const char* name, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    buffer.records[head & (kZoneCapacity - 1)] = ZoneRecord{name, startNs, endNs, depth};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+std::uint32_t Profiler::PushDepth() {
+    return GetThreadBuffer().depth++;
+}
+
+void Profiler::PopDepth() {
+    --GetThreadBuffer().depth;
+}
+
+std::string Profiler::ExportChromeTraceJson(std::uint32_t frameCount) {
+    Registry& registry = GetRegistry();
+    
+    // 対象期間の開始時刻 = 直近frameCountフレームの先頭フレーム開始時刻
+    std::uint64_t windowStart = std::max(registry.epoch, registry.resetTime.load(std::memory_order_relaxed));
+    const std::uint64_t currentFrame = registry.frameIndex.load(std::memory_order_acquire);
+    if (currentFrame > 0 && frameCount > 0) {
+        const std::uint64_t frames = std::min<std::uint64_t>({frameCount, currentFrame, kFrameHistory - 1});
+        const std::uint64_t firstFrame = currentFrame - frames + 1;
+        windowStart = std::max(windowStart,
+                               registry.frameStarts[firstFrame % kFrameHistory].load(std::memory_order_relaxed));
+    }
+    
+    std::string json;
+    json.reserve(1 << 16);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto appendSeparator = [&]() {
+        if (!first) {
+            json += ',';
+        }
+        first = false;
+    };
+    
+    std::vector<ZoneRecord> snapshot;
+    std::lock_guard lock(registry.mutex);
+    for (const auto& buffer : registry.buffers) {
+        appendSeparator();
+        json += fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+                            buffer->threadId);
+        AppendJsonEscaped(json, buffer->name.c_str());
+        json += "\"}}";
+        
+        // 書き込み中のスレッドと競合しうるため、コピー後に上書きされた可能性のある範囲を除外する
+        const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+        const std::uint64_t begin = head > kZoneCapacity ? head - kZoneCapacity : 0;
+        snapshot.clear();
+        for (std::uint64_t i = begin; i < head; ++i) {
+            snapshot.push_back(buffer->records[i & (kZoneCapacity - 1)]);
+        }
+        // 書き込み側はheadの位置へ書いてからhead + 1を公開するため、headAfterの位置も書き込み中の可能性がある
+        const std::uint64_t headAfter = buffer->head.load(std::memory_order_acquire);
+        const std::uint64_t overwritten = headAfter + 1 > kZoneCapacity ? headAfter + 1 - kZoneCapacity : 0;
+        const std::uint64_t skip = overwritten > begin ? std::min<std::uint64_t>(overwritten - begin, snapshot.size()) : 0;
+        
+        for (std::size_t i = static_cast<std::size_t>(skip); i < snapshot.size(); ++i) {
+            const ZoneRecord& zone = snapshot[i];
+            if (zone.startNs < windowStart || zone.endNs < zone.startNs) {
+                continue;
+            }
+            appendSeparator();
+            json += "{\"name\":\"";
+            AppendJsonEscaped(json, zone.name);
+            fmt::format_to(std::back_inserter(json),
+                           "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"depth\":{}}}}}",
+                           buffer->threadId,
+                           static_cast<double>(zone.startNs - registry.epoch) / 1000.0,
+                           static_cast<double>(zone.endNs - zone.startNs) / 1000.0,
+                           zone.depth);
+        }
+    }
+    json += "]}";
+    return json;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path, std::uint32_t frameCount) {
+    const std::string json = ExportChromeTraceJson(frameCount);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        spdlog::error("プロファイル出力ファイルを開けません: {}", path);
+        return false;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file) {
+        spdlog::error("プロファイル出力の書き込みに失敗: {}", path);
+        return false;
+    }
+    spdlog::info("プロファイル出力完了: {} (直近{}フレーム, {} bytes)", path, frameCount, json.size());
+    return true;
+}
+
+void Profiler::Reset() {
+    GetRegistry().resetTime.store(Now(), std::memory_order_relaxed);
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "core/StartupTrace.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace BoxelGame {
+
+StartupTrace::StartupTrace()
+    : m_origin(Clock::now()), m_main_thread(std::this_thread::get_id()) {
+    m_phases.reserve(32);
+}
+
+StartupTrace::Phase::Phase(StartupTrace* trace, std::string name)
+    : m_trace(trace), m_name(std::move(name)), m_start(Clock::now()) {
+}
+
+StartupTrace::Phase::~Phase() {
+    if (m_trace) {
+        m_trace->Record(std::move(m_name), m_start, Clock::now());
+    }
+}
+
+void StartupTrace::Finish() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_finished) {
+        m_finish = Clock::now();
+        m_finished = true;
+    }
+}
+
+bool StartupTrace::IsFinished() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_finished;
+}
+
+double StartupTrace::GetTotalSeconds() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Clock::time_point end = m_finished ? m_finish : Clock::now();
+    return std::chrono::duration<double>(end - m_origin).count();
+}
+
+double StartupTrace::GetElapsedSeconds() const {
+    return std::chrono::duration<double>(Clock::now() - m_origin).count();
+}
+
+std::vector<StartupPhaseRecord> StartupTrace::GetPhases() const {
+    std::vector<StartupPhaseRecord> phases;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        phases = m_phases;
+    }
+    std::stable_sort(phases.begin(), phases.end(), [](const StartupPhaseRecord& a, const StartupPhaseRecord& b) {
+        return a.startMs < b.startMs;
+    });
+    return phases;
+}
+
+void StartupTrace::LogReport(double budgetSeconds) const {
+    const double totalSeconds = GetTotalSeconds();
+    const std::vector<StartupPhaseRecord> phases = GetPhases();
+    
+    spdlog::info("起動時間: {:.1f}ms (予算 {:.0f}ms: {})", totalSeconds * 1000.0, budgetSeconds * 1000.0,
+                 totalSeconds <= budgetSeconds ? "達成" : "超過");
+    for (const StartupPhaseRecord& phase : phases) {
+        spdlog::info("  {:>8.1f}ms +{:>8.1f}ms  {}{}", phase.startMs, phase.durationMs, phase.name,
+                     phase.onMainThread ? "" : " (ワーカー)");
+    }
+    if (totalSeconds > budgetSeconds) {
+        spdlog::warn("起動時間が予算を超過しました: {:.1f}ms > {:.0f}ms", totalSeconds * 1000.0, budgetSeconds * 1000.0);
+    }
+}
+
+void StartupTrace::Record(std::string name, Clock::time_point start, Clock::time_point end) {
+    StartupPhaseRecord record;
+    record.name = std::move(name);
+    record.startMs = ToMilliseconds(start);
+    record.durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+    record.onMainThread = std::this_thread::get_id() == m_main_thread;
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_phases.push_back(std::move(record));
+}
+
+double StartupTrace::ToMilliseconds(Clock::time_point time) const {
+    return std::chrono::duration<double, std::milli>(time - m_origin).count();
+}
+
+} // namespace BoxelGame
\ No newline at end of file
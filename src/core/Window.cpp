@@ -1,4 +1,6 @@
 #include "core/Window.hpp"
+#include "core/Log.hpp"
+#include "core/Profiler.hpp"
 #include <glad/gl.h>       // GLADを先に読み込み
 #define GLFW_INCLUDE_NONE // GLFWにOpenGLヘッダーを含めさせない
 #include <GLFW/glfw3.h> // GLFWはGLADの後
@@ -6,15 +8,25 @@
 
 namespace BoxelGame {
 
-Window::Window(int width, int height, const std::string& title)
+Window::Window(int width, int height, const std::string& title, StartupTrace* startupTrace)
     : m_window(nullptr), m_width(width), m_height(height), m_title(title) {
+    StoreFramebufferSize(width, height);
     
     try {
         spdlog::info("ウィンドウ初期化開始: {}x{} \"{}\"", width, height, title);
         
-        InitializeGLFW();
-        InitializeWindow();
-        InitializeOpenGL();
+        {
+            StartupTrace::Phase phase(startupTrace, "GLFW初期化");
+            InitializeGLFW();
+        }
+        {
+            StartupTrace::Phase phase(startupTrace, "ウィンドウ・GLコンテキスト作成");
+            InitializeWindow();
+        }
+        {
+            StartupTrace::Phase phase(startupTrace, "OpenGL関数ロード (GLAD)");
+            InitializeOpenGL();
+        }
         SetupCallbacks();
         
         spdlog::info("ウィンドウ初期化完了");
@@ -38,6 +50,9 @@ Window::~Window() {
     }
     
     glfwTerminate();
+    if (m_dropped_input_events > 0) {
+        spdlog::warn("入力キュー満杯により破棄した入力イベント: {}件", m_dropped_input_events);
+    }
     spdlog::info("ウィンドウ破棄完了");
 }
 
@@ -46,22 +61,62 @@ bool Window::ShouldClose() const {
 }
 
 void Window::SwapBuffers() {
+    BOXEL_PROFILE_SCOPE("Window::SwapBuffers");
     if (m_window) {
         glfwSwapBuffers(m_window);
     }
 }
 
+void Window::MakeContextCurrent() {
+    if (m_window) {
+        glfwMakeContextCurrent(m_window);
+    }
+}
+
+void Window::DetachContext() {
+    if (m_window && glfwGetCurrentContext() == m_window) {
+        glfwMakeContextCurrent(nullptr);
+    }
+}
+
 void Window::PollEvents() {
     glfwPollEvents();
 }
 
 void Window::GetFramebufferSize(int& width, int& height) const {
-    if (m_window) {
-        glfwGetFramebufferSize(m_window, &width, &height);
-    } else {
-        width = m_width;
-        height = m_height;
+    const std::uint64_t size = m_framebuffer_size.load(std::memory_order_acquire);
+    width = static_cast<int>(static_cast<std::uint32_t>(size >> 32));
+    height = static_cast<int>(static_cast<std::uint32_t>(size));
+}
+
+void Window::StoreFramebufferSize(int width, int height) {
+    const std::uint64_t size = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(width)) << 32) |
+                               static_cast<std::uint32_t>(height);
+    m_framebuffer_size.store(size, std::memory_order_release);
+}
+
+void Window::SetPresentMode(PresentMode mode) {
+    if (!m_window) {
+        m_present_mode = mode;
+        return;
+    }
+    
+    // 適応型VSyncは swap_control_tear 拡張が必要
+    if (mode == PresentMode::Adaptive &&
+        !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+        !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+        spdlog::warn("適応型VSync非対応のため通常のVSyncを使用");
+        mode = PresentMode::VSync;
     }
+    
+    switch (mode) {
+        case PresentMode::VSync: glfwSwapInterval(1); break;
+        case PresentMode::Adaptive: glfwSwapInterval(-1); break;
+        case PresentMode::Immediate: glfwSwapInterval(0); break;
+    }
+    m_present_mode = mode;
+    
+    spdlog::info("提示モード設定: {}", GetPresentModeName(mode));
 }
 
 void Window::InitializeGLFW() {
@@ -117,7 +172,7 @@ void Window::InitializeWindow() {
     }
     
     glfwMakeContextCurrent(m_window);
-    glfwSwapInterval(1); // VSync有効
+    SetPresentMode(m_present_mode);
     
     spdlog::info("ウィンドウ作成完了");
 }
@@ -161,6 +216,7 @@ void Window::InitializeOpenGL() {
     int fbWidth, fbHeight;
     glfwGetFramebufferSize(m_window, &fbWidth, &fbHeight);
     glViewport(0, 0, fbWidth, fbHeight);
+    StoreFramebufferSize(fbWidth, fbHeight);
     
     spdlog::info("OpenGL初期化完了");
 }
@@ -168,6 +224,10 @@ void Window::InitializeOpenGL() {
 void Window::SetupCallbacks() {
     glfwSetWindowUserPointer(m_window, this);
     glfwSetFramebufferSizeCallback(m_window, FramebufferSizeCallback);
+    glfwSetKeyCallback(m_window, KeyCallback);
+    glfwSetMouseButtonCallback(m_window, MouseButtonCallback);
+    glfwSetCursorPosCallback(m_window, CursorPosCallback);
+    glfwSetScrollCallback(m_window, ScrollCallback);
     
     spdlog::info("GLFWコールバック設定完了");
 }
@@ -196,14 +256,67 @@ void Window::ErrorCallback(int error, const char* description) {
     }
 }
 
+void Window::PushInputEvent(const InputEvent& event) {
+    // コールバック内では記録のみ行い、処理はシミュレーションtickで行う
+    if (!m_input_events.TryPush(event)) {
+        ++m_dropped_input_events;
+    }
+}
+
 void Window::FramebufferSizeCallback(GLFWwindow* window, int width, int height) {
-    glViewport(0, 0, width, height);
-    
     auto* windowObj = static_cast<Window*>(glfwGetWindowUserPointer(window));
     if (windowObj) {
         windowObj->m_width = width;
         windowObj->m_height = height;
-        spdlog::debug("フレームバッファサイズ変更: {}x{}", width, height);
+        windowObj->StoreFramebufferSize(width, height);
+        BOXEL_LOG_DEBUG("フレームバッファサイズ変更: {}x{}", width, height);
+    }
+}
+
+void Window::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (auto* windowObj = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        InputEvent event;
+        event.type = InputEventType::Key;
+        event.timestampNs = GetInputTimestamp();
+        event.code = key;
+        event.scancode = scancode;
+        event.action = action;
+        event.mods = mods;
+        windowObj->PushInputEvent(event);
+    }
+}
+
+void Window::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    if (auto* windowObj = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        InputEvent event;
+        event.type = InputEventType::MouseButton;
+        event.timestampNs = GetInputTimestamp();
+        event.code = button;
+        event.action = action;
+        event.mods = mods;
+        windowObj->PushInputEvent(event);
+    }
+}
+
+void Window::CursorPosCallback(GLFWwindow* window, double x, double y) {
+    if (auto* windowObj = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        InputEvent event;
+        event.type = InputEventType::CursorMove;
+        event.timestampNs = GetInputTimestamp();
+        event.x = x;
+        event.y = y;
+        windowObj->PushInputEvent(event);
+    }
+}
+
+void Window::ScrollCallback(GLFWwindow* window, double xOffset, double yOffset) {
+    if (auto* windowObj = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        InputEvent event;
+        event.type = InputEventType::Scroll;
+        event.timestampNs = GetInputTimestamp();
+        event.x = xOffset;
+        event.y = yOffset;
+        windowObj->PushInputEvent(event);
     }
 }
 
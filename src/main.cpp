@@ -1,10 +1,84 @@
 #include "core/Application.hpp"
+#include "core/HeadlessWindow.hpp"
 #include <spdlog/spdlog.h>
+#include <cstdint>
+#include <memory>
+#include <string>
 
-int main() {
+namespace {
+
+// --headless で --frames を省略した場合のフレーム数（ヘッドレスウィンドウは閉じられないため有限にする）
+constexpr std::uint64_t kDefaultHeadlessFrameCount = 600;
+
+// コマンドライン引数
+struct LaunchOptions {
+    bool headless = false;       // --headless: GLコンテキスト無しで実行
+    std::uint64_t frameCount = 0; // --frames N: Nフレームで終了（0は無制限）
+    BoxelGame::ApplicationConfig config;
+};
+
+LaunchOptions ParseLaunchOptions(int argc, char* argv[]) {
+    LaunchOptions options;
+    options.config.streamWorld = true;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frameCount = std::stoull(argv[++i]);
+        } else if (arg == "--benchmark") {
+            options.config.presentMode = BoxelGame::PresentMode::Immediate;
+        } else if (arg == "--present-mode" && i + 1 < argc) {
+            const std::string mode = argv[++i];
+            if (mode == "vsync") {
+                options.config.presentMode = BoxelGame::PresentMode::VSync;
+            } else if (mode == "adaptive") {
+                options.config.presentMode = BoxelGame::PresentMode::Adaptive;
+            } else if (mode == "immediate") {
+                options.config.presentMode = BoxelGame::PresentMode::Immediate;
+            } else {
+                spdlog::warn("不明な提示モードを無視: {}", mode);
+            }
+        } else if (arg == "--single-thread-render") {
+            options.config.threadedRendering = false;
+        } else if (arg == "--render-buffers" && i + 1 < argc) {
+            options.config.renderBufferCount = std::stoul(argv[++i]);
+        } else if (arg == "--no-world") {
+            options.config.streamWorld = false;
+        } else if (arg == "--view-distance" && i + 1 < argc) {
+            options.config.streaming.viewDistance = std::stoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.config.terrain.seed = static_cast<std::uint32_t>(std::stoul(argv[++i]));
+        } else if (arg == "--profile-out" && i + 1 < argc) {
+            options.config.profileOutputPath = argv[++i];
+        } else {
+            spdlog::warn("不明な引数を無視: {}", arg);
+        }
+    }
+    if (options.headless && options.frameCount == 0) {
+        options.frameCount = kDefaultHeadlessFrameCount;
+        spdlog::info("--frames の指定が無いため{}フレームで終了します", options.frameCount);
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
     try {
-        BoxelGame::Application app;
-        app.Run();
+        const LaunchOptions options = ParseLaunchOptions(argc, argv);
+        
+        std::unique_ptr<BoxelGame::IWindow> window;
+        if (options.headless) {
+            window = std::make_unique<BoxelGame::HeadlessWindow>();
+        }
+        
+        BoxelGame::Application app(std::move(window), options.config);
+        if (options.frameCount > 0) {
+            app.RunFrames(options.frameCount);
+        } else {
+            app.Run();
+        }
         
     } catch (const BoxelGame::InitializationException& e) {
         spdlog::error("初期化エラー: {}", e.what());
@@ -0,0 +1,354 @@
+#include "render/GreedyMesher.hpp"
+#include "core/Profiler.hpp"
+#include "world/BlockRegistry.hpp"
+#include <bit>
+
+namespace BoxelGame {
+
+namespace {
+
+// 境界ビット（0と17）を除いたチャンク内部の18ビット列マスク
+constexpr std::uint32_t kInteriorMask = ((1u << kChunkSize) - 1) << 1;
+
+constexpr int ColumnIndex(int uPadded, int vPadded) {
+    return vPadded * kPaddedChunkSize + uPadded;
+}
+
+// 面・スライス・面内座標 → チャンクローカル座標
+struct LocalPosition {
+    int x;
+    int y;
+    int z;
+};
+
+constexpr LocalPosition ToLocal(BlockFace face, int slice, int u, int v) {
+    switch (GetFaceAxis(face)) {
+        case 0: return {slice, v, u};
+        case 1: return {u, slice, v};
+        default: return {u, v, slice};
+    }
+}
+
+// 面の統合キー: ブロック種別（下位16ビット）と角ごとのAO（上位8ビット）。0は面無し
+using FaceKey = std::uint32_t;
+
+constexpr FaceKey MakeFaceKey(BlockId block, std::uint8_t ambientOcclusion) {
+    return block | (static_cast<FaceKey>(ambientOcclusion) << 16);
+}
+
+// 面の外側（空気側）の層で、面内の周囲8ブロックから角ごとのAOを求める
+// occupied(u, v) は空気側の層の面内座標 [-1, kChunkSize] のブロックが面を隠すか（IsFaceOccludingBlock）
+// 角の2辺が共に塞がれていれば0、それ以外は 3 - (辺 + 辺 + 角) の遮蔽数
+template <typename Occupied>
+std::uint8_t ComputeFaceAmbientOcclusion(const Occupied& occupied, int u, int v) {
+    std::uint8_t packed = 0;
+    for (int cornerV = 0; cornerV < 2; ++cornerV) {
+        for (int cornerU = 0; cornerU < 2; ++cornerU) {
+            const int du = cornerU != 0 ? 1 : -1;
+            const int dv = cornerV != 0 ? 1 : -1;
+            const int side1 = occupied(u + du, v) ? 1 : 0;
+            const int side2 = occupied(u, v + dv) ? 1 : 0;
+            const int corner = occupied(u + du, v + dv) ? 1 : 0;
+            const int ao = side1 != 0 && side2 != 0 ? 0 : 3 - (side1 + side2 + corner);
+            packed |= static_cast<std::uint8_t>(ao << GetAmbientOcclusionShift(cornerU, cornerV));
+        }
+    }
+    return packed;
+}
+
+MeshQuad MakeQuad(BlockFace face, int slice, int u, int v, int width, int height, FaceKey key) {
+    const LocalPosition position = ToLocal(face, slice, u, v);
+    MeshQuad quad;
+    quad.x = static_cast<std::uint8_t>(position.x);
+    quad.y = static_cast<std::uint8_t>(position.y);
+    quad.z = static_cast<std::uint8_t>(position.z);
+    quad.width = static_cast<std::uint8_t>(width);
+    quad.height = static_cast<std::uint8_t>(height);
+    quad.face = face;
+    quad.textureLayer = GetBlockTextureLayer(static_cast<BlockId>(key & 0xFFFF), face);
+    quad.ambientOcclusion = static_cast<std::uint8_t>(key >> 16);
+    return quad;
+}
+
+using SliceKeys = std::array<std::array<FaceKey, kChunkSize>, kChunkSize>;  // [v][u]
+
+// スライスの可視面行マスクから矩形を統合し、頂点としてoutへ出力する（rowsは消費される）
+// keys[v][u] は可視面の統合キー（種別とAOが共に一致する面のみ統合する）
+void MergeSliceRows(std::array<std::uint16_t, kChunkSize>& rows, const SliceKeys& keys, BlockFace face, int slice,
+                    std::vector<PackedVoxelVertex>& out) {
+    for (int v = 0; v < kChunkSize; ++v) {
+        while (rows[v] != 0) {
+            const int u = std::countr_zero(rows[v]);
+            const FaceKey key = keys[v][u];
+            
+            // 連続するビット数を求め、その範囲内でキーが変わる位置で打ち切る
+            const int run = std::countr_one(static_cast<std::uint32_t>(rows[v]) >> u);
+            int width = 1;
+            while (width < run && keys[v][u + width] == key) {
+                ++width;
+            }
+            const auto runMask = static_cast<std::uint16_t>(((1u << width) - 1) << u);
+            
+            // 上の行が同じ範囲を全て持ち、キーも一致する限り高さを伸ばす
+            int height = 1;
+            while (v + height < kChunkSize && (rows[v + height] & runMask) == runMask) {
+                bool sameKey = true;
+                for (int i = 0; i < width && sameKey; ++i) {
+                    sameKey = keys[v + height][u + i] == key;
+                }
+                if (!sameKey) {
+                    break;
+                }
+                ++height;
+            }
+            
+            for (int i = 0; i < height; ++i) {
+                rows[v + i] &= static_cast<std::uint16_t>(~runMask);
+            }
+            AppendQuadVertices(MakeQuad(face, slice, u, v, width, height, key), out);
+        }
+    }
+}
+
+} // namespace
+
+void GreedyMesher::Mesh(const PaddedChunk& chunk, ChunkMesh& out) {
+    BOXEL_PROFILE_SCOPE("GreedyMesher::Mesh");
+    
+    out.Clear();
+    BuildColumns(chunk);
+    BuildFaceRows();
+    MergeFaces(chunk, out);
+}
+
+void GreedyMesher::BuildColumns(const PaddedChunk& chunk) {
+    for (auto& columns : m_columns) {
+        columns.fill(0);
+    }
+    for (auto& columns : m_occluder_columns) {
+        columns.fill(0);
+    }
+    
+    // 列インデックスは(u, v)、ビット位置は法線軸の座標
+    // X軸: u=z, v=y / Y軸: u=x, v=z / Z軸: u=x, v=y
+    for (int y = 0; y < kPaddedChunkSize; ++y) {
+        for (int z = 0; z < kPaddedChunkSize; ++z) {
+            const BlockId* row = &chunk.blocks[PaddedChunk::Index(0, y, z)];
+            std::uint32_t& columnX = m_columns[0][ColumnIndex(z, y)];
+            std::uint32_t& occluderX = m_occluder_columns[0][ColumnIndex(z, y)];
+            for (int x = 0; x < kPaddedChunkSize; ++x) {
+                if (IsCubeBlock(row[x])) {
+                    columnX |= 1u << x;
+                    m_columns[1][ColumnIndex(x, z)] |= 1u << y;
+                    m_columns[2][ColumnIndex(x, y)] |= 1u << z;
+                }
+                if (IsFaceOccludingBlock(row[x])) {
+                    occluderX |= 1u << x;
+                    m_occluder_columns[1][ColumnIndex(x, z)] |= 1u << y;
+                    m_occluder_columns[2][ColumnIndex(x, y)] |= 1u << z;
+                }
+            }
+        }
+    }
+}
+
+void GreedyMesher::BuildFaceRows() {
+    for (auto& slices : m_face_rows) {
+        for (auto& rows : slices) {
+            rows.fill(0);
+        }
+    }
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        auto& positiveRows = m_face_rows[axis * 2];
+        auto& negativeRows = m_face_rows[axis * 2 + 1];
+        for (int v = 0; v < kChunkSize; ++v) {
+            for (int u = 0; u < kChunkSize; ++u) {
+                const std::uint32_t column = m_columns[axis][ColumnIndex(u + 1, v + 1)];
+                const std::uint32_t occluders = m_occluder_columns[axis][ColumnIndex(u + 1, v + 1)];
+                // 正方向の面: 自身が立方体で次が面を隠さない / 負方向の面: 自身が立方体で前が面を隠さない
+                std::uint32_t positive = column & ~(occluders >> 1) & kInteriorMask;
+                std::uint32_t negative = column & ~(occluders << 1) & kInteriorMask;
+                const auto uBit = static_cast<std::uint16_t>(1u << u);
+                
+                // 可視面のビットのみ走査してスライス行マスクへ転置
+                while (positive != 0) {
+                    const int slice = std::countr_zero(positive) - 1;
+                    positiveRows[slice][v] |= uBit;
+                    positive &= positive - 1;
+                }
+                while (negative != 0) {
+                    const int slice = std::countr_zero(negative) - 1;
+                    negativeRows[slice][v] |= uBit;
+                    negative &= negative - 1;
+                }
+            }
+        }
+    }
+}
+
+void GreedyMesher::MergeFaces(const PaddedChunk& chunk, ChunkMesh& out) {
+    SliceKeys keys{};
+    for (int faceIndex = 0; faceIndex < kBlockFaceCount; ++faceIndex) {
+        const auto face = static_cast<BlockFace>(faceIndex);
+        const int axis = GetFaceAxis(face);
+        const auto& columns = m_occluder_columns[axis];
+        for (int slice = 0; slice < kChunkSize; ++slice) {
+            auto& rows = m_face_rows[faceIndex][slice];
+            
+            // 空気側の層の遮蔽は、法線軸の遮蔽列の該当ビット（境界込み座標）で引く
+            const int layerBit = IsPositiveFace(face) ? slice + 2 : slice;
+            const auto occupied = [&](int u, int v) {
+                return ((columns[ColumnIndex(u + 1, v + 1)] >> layerBit) & 1u) != 0;
+            };
+            for (int v = 0; v < kChunkSize; ++v) {
+                for (std::uint32_t bits = rows[v]; bits != 0; bits &= bits - 1) {
+                    const int u = std::countr_zero(bits);
+                    const LocalPosition p = ToLocal(face, slice, u, v);
+                    keys[v][u] = MakeFaceKey(chunk.Get(p.x, p.y, p.z), ComputeFaceAmbientOcclusion(occupied, u, v));
+                }
+            }
+            
+            MergeSliceRows(rows, keys, face, slice, out.vertices);
+            out.EndSlice(face, slice);
+        }
+    }
+}
+
+int GreedyMesher::RemeshAroundBlock(const ChunkNeighborhood& neighborhood, int x, int y, int z, ChunkMesh& mesh) {
+    BOXEL_PROFILE_SCOPE("GreedyMesher::RemeshAroundBlock");
+    
+    // 変化し得る面: 変更ブロック自身の6面と、変更ブロックの層を空気側に持つ面
+    // （6近傍ブロックの変更ブロック側の面、およびAOの周囲8ブロックに変更ブロックを含む面）
+    // 面を持つブロックがこのチャンク内にあるスライスのみ作り直す
+    const int position[3] = {x, y, z};
+    std::array<bool, ChunkMesh::kSliceCount> dirty{};
+    const auto inside = [](int value) { return value >= 0 && value < kChunkSize; };
+    const auto adjacent = [](int value) { return value >= -1 && value <= kChunkSize; };
+    for (int axis = 0; axis < 3; ++axis) {
+        const int a = position[axis];
+        const int b = position[(axis + 1) % 3];
+        const int c = position[(axis + 2) % 3];
+        if (!adjacent(b) || !adjacent(c)) {
+            continue;
+        }
+        const auto positive = static_cast<BlockFace>(axis * 2);
+        const auto negative = static_cast<BlockFace>(axis * 2 + 1);
+        const struct {
+            BlockFace face;
+            int slice;
+        } candidates[] = {{positive, a}, {negative, a}, {positive, a - 1}, {negative, a + 1}};
+        for (const auto& candidate : candidates) {
+            if (inside(candidate.slice)) {
+                dirty[ChunkMesh::SliceIndex(candidate.face, candidate.slice)] = true;
+            }
+        }
+    }
+    
+    int rebuilt = 0;
+    for (int index = 0; index < ChunkMesh::kSliceCount; ++index) {
+        if (!dirty[index]) {
+            continue;
+        }
+        const auto face = static_cast<BlockFace>(index / kChunkSize);
+        const int slice = index % kChunkSize;
+        m_slice_vertices.clear();
+        MeshSlice(neighborhood, face, slice, m_slice_vertices);
+        mesh.ReplaceSlice(face, slice, m_slice_vertices);
+        ++rebuilt;
+    }
+    return rebuilt;
+}
+
+void GreedyMesher::MeshSlice(const ChunkNeighborhood& neighborhood, BlockFace face, int slice,
+                             std::vector<PackedVoxelVertex>& out) {
+    const int axis = GetFaceAxis(face);
+    const int step = IsPositiveFace(face) ? 1 : -1;
+    const int normal[3] = {axis == 0 ? step : 0, axis == 1 ? step : 0, axis == 2 ? step : 0};
+    
+    const auto occupied = [&](int u, int v) {
+        const LocalPosition p = ToLocal(face, slice, u, v);
+        return IsFaceOccludingBlock(neighborhood.GetBlock(p.x + normal[0], p.y + normal[1], p.z + normal[2]));
+    };
+    
+    // スライス内の可視面を行マスクと統合キーへ
+    std::array<std::uint16_t, kChunkSize> rows{};
+    SliceKeys keys{};
+    for (int v = 0; v < kChunkSize; ++v) {
+        for (int u = 0; u < kChunkSize; ++u) {
+            const LocalPosition p = ToLocal(face, slice, u, v);
+            const BlockId block = neighborhood.GetBlock(p.x, p.y, p.z);
+            if (IsCubeBlock(block) && !occupied(u, v)) {
+                rows[v] |= static_cast<std::uint16_t>(1u << u);
+                keys[v][u] = MakeFaceKey(block, ComputeFaceAmbientOcclusion(occupied, u, v));
+            }
+        }
+    }
+    
+    MergeSliceRows(rows, keys, face, slice, out);
+}
+
+void NaiveMesher::Mesh(const PaddedChunk& chunk, ChunkMesh& out) {
+    BOXEL_PROFILE_SCOPE("NaiveMesher::Mesh");
+    
+    out.Clear();
+    constexpr int kNormals[kBlockFaceCount][3] = {
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+    };
+    
+    // スライスごとの可視面の統合キー（0は面無し）
+    FaceKey mask[kChunkSize][kChunkSize];
+    for (int faceIndex = 0; faceIndex < kBlockFaceCount; ++faceIndex) {
+        const auto face = static_cast<BlockFace>(faceIndex);
+        const int* normal = kNormals[faceIndex];
+        for (int slice = 0; slice < kChunkSize; ++slice) {
+            const auto occupied = [&](int u, int v) {
+                const LocalPosition p = ToLocal(face, slice, u, v);
+                return IsFaceOccludingBlock(chunk.Get(p.x + normal[0], p.y + normal[1], p.z + normal[2]));
+            };
+            for (int v = 0; v < kChunkSize; ++v) {
+                for (int u = 0; u < kChunkSize; ++u) {
+                    const LocalPosition p = ToLocal(face, slice, u, v);
+                    const BlockId block = chunk.Get(p.x, p.y, p.z);
+                    mask[v][u] = IsCubeBlock(block) && !occupied(u, v)
+                        ? MakeFaceKey(block, ComputeFaceAmbientOcclusion(occupied, u, v)) : 0;
+                }
+            }
+            
+            for (int v = 0; v < kChunkSize; ++v) {
+                for (int u = 0; u < kChunkSize; ++u) {
+                    const FaceKey key = mask[v][u];
+                    if (key == 0) {
+                        continue;
+                    }
+                    
+                    int width = 1;
+                    while (u + width < kChunkSize && mask[v][u + width] == key) {
+                        ++width;
+                    }
+                    int height = 1;
+                    while (v + height < kChunkSize) {
+                        bool rowMatches = true;
+                        for (int i = 0; i < width && rowMatches; ++i) {
+                            rowMatches = mask[v + height][u + i] == key;
+                        }
+                        if (!rowMatches) {
+                            break;
+                        }
+                        ++height;
+                    }
+                    
+                    for (int j = 0; j < height; ++j) {
+                        for (int i = 0; i < width; ++i) {
+                            mask[v + j][u + i] = 0;
+                        }
+                    }
+                    out.AddQuad(MakeQuad(face, slice, u, v, width, height, key));
+                }
+            }
+            out.EndSlice(face, slice);
+        }
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "render/LodSelector.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace BoxelGame {
+
+LodSelector::LodSelector()
+    : LodSelector(Config{}) {
+}
+
+LodSelector::LodSelector(const Config& config)
+    : m_config(config) {
+    if (m_config.maxLevel < 0 || m_config.maxLevel > kMaxLodLevel) {
+        throw InitializationException("LodSelector", "最大LODレベルは0〜" + std::to_string(kMaxLodLevel) + "の範囲で指定");
+    }
+    if (m_config.level1Distance <= 0.0f || m_config.hysteresis < 0.0f ||
+        m_config.hysteresis >= m_config.level1Distance) {
+        throw InitializationException("LodSelector", "切り替え距離は正、不感帯の幅は0以上かつ切り替え距離未満で指定");
+    }
+}
+
+float LodSelector::GetSwitchDistance(int level) const {
+    return level <= 0 ? 0.0f : m_config.level1Distance * static_cast<float>(GetLodScale(level - 1));
+}
+
+void LodSelector::Select(float viewerX, float viewerY, float viewerZ,
+                         const ChunkCoord& minChunk, const ChunkCoord& maxChunk, std::vector<LodNode>& out) {
+    BOXEL_PROFILE_SCOPE("LodSelector::Select");
+    
+    out.clear();
+    for (LevelState& state : m_current) {
+        state.coarse.clear();
+        state.split.clear();
+    }
+    
+    const float viewer[3] = {viewerX, viewerY, viewerZ};
+    const int rootLevel = m_config.maxLevel;
+    const ChunkCoord rootMin = ToLodRegion(minChunk, rootLevel);
+    const ChunkCoord rootMax = ToLodRegion(maxChunk, rootLevel);
+    for (int y = rootMin.y; y <= rootMax.y; ++y) {
+        for (int z = rootMin.z; z <= rootMax.z; ++z) {
+            for (int x = rootMin.x; x <= rootMax.x; ++x) {
+                Visit({x, y, z}, rootLevel, viewer, minChunk, maxChunk, out);
+            }
+        }
+    }
+    
+    // 今回辿らなかった領域の状態は捨てる
+    std::swap(m_previous, m_current);
+}
+
+void LodSelector::Visit(const ChunkCoord& region, int level, const float viewer[3],
+                        const ChunkCoord& minChunk, const ChunkCoord& maxChunk, std::vector<LodNode>& out) {
+    const int scale = GetLodScale(level);
+    const ChunkCoord origin = GetLodRegionOrigin(region, level);
+    const int regionMin[3] = {origin.x, origin.y, origin.z};
+    const int rangeMin[3] = {minChunk.x, minChunk.y, minChunk.z};
+    const int rangeMax[3] = {maxChunk.x, maxChunk.y, maxChunk.z};
+    for (int axis = 0; axis < 3; ++axis) {
+        if (regionMin[axis] + scale - 1 < rangeMin[axis] || regionMin[axis] > rangeMax[axis]) {
+            return;
+        }
+    }
+    
+    if (level == 0) {
+        out.push_back({region, 0});
+        return;
+    }
+    
+    // 視点から領域（AABB）の最近点までの距離（チャンク単位）
+    float distanceSquared = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        const float lower = static_cast<float>(regionMin[axis] * kChunkSize);
+        const float upper = static_cast<float>((regionMin[axis] + scale) * kChunkSize);
+        const float offset = std::max({lower - viewer[axis], 0.0f, viewer[axis] - upper}) / kChunkSize;
+        distanceSquared += offset * offset;
+    }
+    const float distance = std::sqrt(distanceSquared);
+    
+    const std::uint64_t key = PackChunkCoord(region);
+    const float threshold = GetSwitchDistance(level);
+    const bool wasCoarse = m_previous[level].coarse.contains(key);
+    const bool wasSplit = m_previous[level].split.contains(key);
+    bool coarse = distance >= threshold;
+    if (wasCoarse) {
+        coarse = distance >= threshold - m_config.hysteresis;
+    } else if (wasSplit) {
+        coarse = distance >= threshold + m_config.hysteresis;
+    }
+    if ((wasCoarse || wasSplit) && coarse != wasCoarse) {
+        ++m_switch_count;
+    }
+    
+    if (coarse) {
+        m_current[level].coarse.insert(key);
+        out.push_back({region, level});
+        return;
+    }
+    
+    m_current[level].split.insert(key);
+    for (int child = 0; child < 8; ++child) {
+        const ChunkCoord childRegion = {region.x * 2 + (child & 1), region.y * 2 + ((child >> 1) & 1),
+                                        region.z * 2 + ((child >> 2) & 1)};
+        Visit(childRegion, level - 1, viewer, minChunk, maxChunk, out);
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "render/MeshingPipeline.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include "render/GreedyMesher.hpp"
+#include <algorithm>
+#include <bit>
+#include <string>
+
+namespace BoxelGame {
+
+MeshingPipeline::MeshingPipeline(JobSystem& jobSystem, std::size_t maxJobsInFlight)
+    : m_job_system(jobSystem),
+      m_completed(std::bit_ceil(std::max<std::size_t>(maxJobsInFlight, 2))) {
+    if (maxJobsInFlight == 0) {
+        throw InitializationException("MeshingPipeline", "同時実行ジョブ数は1以上を指定");
+    }
+    
+    m_job_storage.reserve(maxJobsInFlight);
+    m_free_jobs.reserve(maxJobsInFlight);
+    for (std::size_t i = 0; i < maxJobsInFlight; ++i) {
+        m_job_storage.push_back(std::make_unique<MeshJob>());
+        m_free_jobs.push_back(m_job_storage.back().get());
+    }
+}
+
+MeshingPipeline::~MeshingPipeline() {
+    // ジョブはスナップショットと完了キューを参照するため、破棄前に全完了を待つ
+    m_job_system.Wait(m_jobs);
+}
+
+void MeshingPipeline::Request(const ChunkCoord& coord, int level) {
+    if (level < 0 || level > kMaxLodLevel) {
+        throw BoxelGameException("LODレベルが範囲外です: " + std::to_string(level));
+    }
+    
+    const std::uint64_t ticket = m_next_ticket++;
+    m_latest_tickets[level][PackChunkCoord(coord)] = ticket;
+    // 古い要求は投入時に要求番号の不一致で読み飛ばす
+    m_pending.push_back({coord, level, ticket});
+}
+
+void MeshingPipeline::Cancel(const ChunkCoord& coord, int level) {
+    if (level >= 0 && level <= kMaxLodLevel) {
+        m_latest_tickets[level].erase(PackChunkCoord(coord));
+    }
+}
+
+void MeshingPipeline::SetViewerPosition(float x, float y, float z) {
+    m_viewer[0] = x;
+    m_viewer[1] = y;
+    m_viewer[2] = z;
+}
+
+void MeshingPipeline::Update(const ChunkManager& chunks, std::vector<CompletedChunkMesh>& out) {
+    BOXEL_PROFILE_SCOPE("MeshingPipeline::Update");
+    
+    CollectCompleted(chunks, out);
+    DispatchPending(chunks);
+}
+
+void MeshingPipeline::CollectCompleted(const ChunkManager& chunks, std::vector<CompletedChunkMesh>& out) {
+    MeshJob* job = nullptr;
+    while (m_completed.TryPop(job)) {
+        --m_jobs_in_flight;
+        
+        auto& latestTickets = m_latest_tickets[job->level];
+        const auto latest = latestTickets.find(PackChunkCoord(job->coord));
+        if (latest == latestTickets.end() || latest->second != job->ticket) {
+            // 取り消し済み、またはより新しい要求がある
+            ++m_discarded_count;
+        } else if (const std::uint64_t revision = ComputeLodRevision(chunks, job->coord, job->level); revision == 0) {
+            // アンロード済み
+            latestTickets.erase(latest);
+            ++m_discarded_count;
+        } else if (revision != job->revision) {
+            // スナップショット後に変更されたため、同じ要求番号のまま作り直す
+            m_pending.push_back({job->coord, job->level, job->ticket});
+            ++m_discarded_count;
+        } else {
+            latestTickets.erase(latest);
+            out.push_back({job->coord, job->level, std::move(job->mesh)});
+            ++m_completed_count;
+        }
+        
+        job->mesh.Clear();
+        m_free_jobs.push_back(job);
+    }
+}
+
+void MeshingPipeline::DispatchPending(const ChunkManager& chunks) {
+    if (m_pending.empty() || m_free_jobs.empty()) {
+        return;
+    }
+    
+    // 取り消し済み・再要求で置き換えられた要求を除去
+    std::erase_if(m_pending, [this](const PendingRequest& request) {
+        const auto& latestTickets = m_latest_tickets[request.level];
+        const auto latest = latestTickets.find(PackChunkCoord(request.coord));
+        return latest == latestTickets.end() || latest->second != request.ticket;
+    });
+    if (m_pending.empty()) {
+        return;
+    }
+    
+    // 視点に近い順に空き枠分だけ末尾へ集める（末尾から取り出して削除を安くする）
+    const std::size_t dispatchCount = std::min(m_free_jobs.size(), m_pending.size());
+    const auto farther = [this](const PendingRequest& a, const PendingRequest& b) {
+        return DistanceSquaredToViewer(a.coord, a.level) > DistanceSquaredToViewer(b.coord, b.level);
+    };
+    const auto nearestBegin = m_pending.end() - static_cast<std::ptrdiff_t>(dispatchCount);
+    if (dispatchCount < m_pending.size()) {
+        std::nth_element(m_pending.begin(), nearestBegin, m_pending.end(), farther);
+    }
+    std::sort(nearestBegin, m_pending.end(), farther);
+    
+    for (std::size_t i = 0; i < dispatchCount; ++i) {
+        const PendingRequest request = m_pending.back();
+        m_pending.pop_back();
+        
+        const std::uint64_t revision = ComputeLodRevision(chunks, request.coord, request.level);
+        if (revision == 0) {
+            m_latest_tickets[request.level].erase(PackChunkCoord(request.coord));
+            ++m_discarded_count;
+            continue;
+        }
+        
+        MeshJob* job = m_free_jobs.back();
+        m_free_jobs.pop_back();
+        job->coord = request.coord;
+        job->level = request.level;
+        job->ticket = request.ticket;
+        job->revision = revision;
+        {
+            BOXEL_PROFILE_SCOPE("MeshingPipeline::Snapshot");
+            BuildLodChunk(chunks, request.coord, request.level, job->snapshot);
+        }
+        
+        ++m_jobs_in_flight;
+        m_job_system.Schedule([this, job] {
+            BOXEL_PROFILE_SCOPE("MeshingPipeline::MeshJob");
+            // メッシャーの作業領域はスレッドごとに保持
+            thread_local GreedyMesher mesher;
+            mesher.Mesh(job->snapshot, job->mesh);
+            // 完了キューの容量は同時実行ジョブ数以上のため失敗しない
+            m_completed.TryPush(job);
+        }, &m_jobs);
+    }
+}
+
+float MeshingPipeline::DistanceSquaredToViewer(const ChunkCoord& coord, int level) const {
+    const int size = kChunkSize * GetLodScale(level);
+    const float half = static_cast<float>(size) * 0.5f;
+    const float dx = static_cast<float>(coord.x * size) + half - m_viewer[0];
+    const float dy = static_cast<float>(coord.y * size) + half - m_viewer[1];
+    const float dz = static_cast<float>(coord.z * size) + half - m_viewer[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
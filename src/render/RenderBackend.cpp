@@ -0,0 +1,31 @@
+#include "render/RenderBackend.hpp"
+#include "core/Profiler.hpp"
+#include "render/VoxelVertex.hpp"
+#include <glad/gl.h>
+
+namespace BoxelGame {
+
+void RenderBackend::Execute(const RenderCommandList& commands) {
+    BOXEL_PROFILE_SCOPE("RenderBackend::Execute");
+    
+    for (const RenderCommand& command : commands.GetCommands()) {
+        switch (command.type) {
+            case RenderCommandType::SetViewport:
+                glViewport(command.viewport[0], command.viewport[1], command.viewport[2], command.viewport[3]);
+                break;
+            case RenderCommandType::Clear:
+                glClearColor(command.clearColor[0], command.clearColor[1], command.clearColor[2], command.clearColor[3]);
+                glClear(GL_COLOR_BUFFER_BIT | (command.clearDepth ? GL_DEPTH_BUFFER_BIT : 0));
+                break;
+        }
+    }
+}
+
+void RenderBackend::SetVoxelVertexLayout() {
+    // 整数のまま頂点シェーダーへ渡し、ビット展開はシェーダー側で行う
+    glEnableVertexAttribArray(kVoxelVertexAttributeLocation);
+    glVertexAttribIPointer(kVoxelVertexAttributeLocation, kVoxelVertexComponentCount, GL_UNSIGNED_INT,
+                           static_cast<GLsizei>(kVoxelVertexStride), nullptr);
+}
+
+} // namespace BoxelGame
\ No newline at end of file
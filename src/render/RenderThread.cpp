@@ -0,0 +1,124 @@
+#include "render/RenderThread.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include "render/RenderBackend.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <string>
+
+namespace BoxelGame {
+
+RenderThread::RenderThread(IWindow& window, std::size_t bufferCount)
+    : m_window(window) {
+    if (bufferCount < kMinBufferCount || bufferCount > kMaxBufferCount) {
+        throw InitializationException("RenderThread",
+                                      "コマンドリスト数は" + std::to_string(kMinBufferCount) + "〜" +
+                                      std::to_string(kMaxBufferCount) + "の範囲で指定: " + std::to_string(bufferCount));
+    }
+    
+    m_lists.resize(bufferCount);
+    for (std::size_t i = 0; i < bufferCount; ++i) {
+        m_free.push_back(i);
+    }
+    
+    m_thread = std::thread(&RenderThread::ThreadMain, this);
+    spdlog::info("描画スレッド起動 (コマンドリスト{}面)", bufferCount);
+}
+
+RenderThread::~RenderThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_ready_cv.notify_one();
+    
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    spdlog::info("描画スレッド停止: {}フレーム提示 (提出待ち累計 {:.2f}ms)",
+                 GetPresentedFrameCount(), m_stall_seconds * 1000.0);
+}
+
+RenderCommandList& RenderThread::BeginFrame(std::uint64_t frameIndex, float alpha) {
+    BOXEL_PROFILE_SCOPE("RenderThread::BeginFrame");
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_free.empty()) {
+        const auto waitStart = std::chrono::steady_clock::now();
+        m_free_cv.wait(lock, [this] { return !m_free.empty(); });
+        m_stall_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count();
+    }
+    
+    m_recording = m_free.front();
+    m_free.pop_front();
+    lock.unlock();
+    
+    RenderCommandList& list = m_lists[m_recording];
+    list.Reset(frameIndex, alpha);
+    return list;
+}
+
+void RenderThread::SubmitFrame() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_recording == SIZE_MAX) {
+            return;
+        }
+        m_ready.push_back(m_recording);
+        m_recording = SIZE_MAX;
+        ++m_in_flight;
+    }
+    m_ready_cv.notify_one();
+}
+
+void RenderThread::Flush() {
+    BOXEL_PROFILE_SCOPE("RenderThread::Flush");
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_free_cv.wait(lock, [this] { return m_in_flight == 0; });
+}
+
+void RenderThread::ThreadMain() {
+    BOXEL_PROFILE_THREAD("Render");
+    m_window.MakeContextCurrent();
+    const bool hasContext = m_window.HasGraphicsContext();
+    
+    while (true) {
+        std::size_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ready_cv.wait(lock, [this] { return m_stop || !m_ready.empty(); });
+            // 停止要求時も提出済みフレームは全て提示してから終了する
+            if (m_ready.empty()) {
+                break;
+            }
+            index = m_ready.front();
+            m_ready.pop_front();
+        }
+        
+        {
+            BOXEL_PROFILE_SCOPE("RenderThread::Frame");
+            try {
+                // ヘッドレス実行時はGL呼び出しを行わない
+                if (hasContext) {
+                    RenderBackend::Execute(m_lists[index]);
+                }
+                m_window.SwapBuffers();
+            } catch (const std::exception& e) {
+                spdlog::error("描画スレッドで例外が発生: {}", e.what());
+            }
+        }
+        m_presented_frames.fetch_add(1, std::memory_order_release);
+        
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_free.push_back(index);
+            --m_in_flight;
+        }
+        m_free_cv.notify_all();
+    }
+    
+    m_window.DetachContext();
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "world/Chunk.hpp"
+#include "core/Exception.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+
+namespace BoxelGame {
+
+namespace {
+
+std::size_t WordCountForBits(int bitsPerBlock) {
+    return static_cast<std::size_t>(kChunkVolume) * static_cast<std::size_t>(bitsPerBlock) / 64;
+}
+
+// 全チャンク共通の版番号（アンロード後に同じアドレスへ再確保されても版は重複しない）
+std::uint64_t NextRevision() {
+    static std::atomic<std::uint64_t> revision{0};
+    return revision.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void WritePacked(std::vector<std::uint64_t>& data, int bitsPerBlock, int index, std::uint64_t value) {
+    const std::size_t bitOffset = static_cast<std::size_t>(index) * static_cast<std::size_t>(bitsPerBlock);
+    const std::uint64_t mask = (std::uint64_t{1} << bitsPerBlock) - 1;
+    std::uint64_t& word = data[bitOffset >> 6];
+    const unsigned shift = static_cast<unsigned>(bitOffset & 63);
+    word = (word & ~(mask << shift)) | ((value & mask) << shift);
+}
+
+} // namespace
+
+Chunk::Chunk(BlockId fill) {
+    Fill(fill);
+}
+
+bool Chunk::SetByIndex(int index, BlockId block) {
+    const std::uint32_t oldIndex = GetPaletteIndex(index);
+    if (m_palette[oldIndex] == block) {
+        return false;
+    }
+    
+    // 拡大時のRepackはパレット番号を保持するためoldIndexはそのまま有効
+    const std::uint32_t newIndex = AcquirePaletteIndex(block);
+    SetPaletteIndex(index, newIndex);
+    ++m_palette_counts[newIndex];
+    
+    if (--m_palette_counts[oldIndex] == 0) {
+        --m_live_palette_entries;
+        ShrinkIfSparse();
+    }
+    m_revision = NextRevision();
+    return true;
+}
+
+void Chunk::Fill(BlockId block) {
+    m_palette.assign(1, block);
+    m_palette_counts.assign(1, static_cast<std::uint16_t>(kChunkVolume));
+    std::vector<std::uint64_t>().swap(m_data);
+    m_live_palette_entries = 1;
+    m_bits_per_block = 0;
+    m_index_mask = 0;
+    m_revision = NextRevision();
+}
+
+void Chunk::Assign(std::span<const BlockId> blocks) {
+    if (blocks.size() != static_cast<std::size_t>(kChunkVolume)) {
+        throw BoxelGameException("チャンクのブロック数が不正: " + std::to_string(blocks.size()));
+    }
+    
+    // 昇順の重複無しパレットを作り、二分探索でパレット番号を引く
+    std::vector<BlockId> palette(blocks.begin(), blocks.end());
+    std::sort(palette.begin(), palette.end());
+    palette.erase(std::unique(palette.begin(), palette.end()), palette.end());
+    palette.shrink_to_fit();
+    
+    if (palette.size() == 1) {
+        Fill(palette[0]);
+        return;
+    }
+    
+    const int bitsPerBlock = BitsForPaletteSize(palette.size());
+    std::vector<std::uint64_t> data(WordCountForBits(bitsPerBlock), 0);
+    std::vector<std::uint16_t> counts(palette.size(), 0);
+    for (int i = 0; i < kChunkVolume; ++i) {
+        const auto it = std::lower_bound(palette.begin(), palette.end(), blocks[static_cast<std::size_t>(i)]);
+        const auto paletteIndex = static_cast<std::uint32_t>(it - palette.begin());
+        WritePacked(data, bitsPerBlock, i, paletteIndex);
+        ++counts[paletteIndex];
+    }
+    
+    m_palette = std::move(palette);
+    m_palette_counts = std::move(counts);
+    m_data = std::move(data);
+    m_live_palette_entries = m_palette.size();
+    m_bits_per_block = bitsPerBlock;
+    m_index_mask = (std::uint64_t{1} << bitsPerBlock) - 1;
+    m_revision = NextRevision();
+}
+
+void Chunk::Unpack(std::span<BlockId> out) const {
+    if (out.size() != static_cast<std::size_t>(kChunkVolume)) {
+        throw BoxelGameException("展開先のブロック数が不正: " + std::to_string(out.size()));
+    }
+    
+    if (IsUniform()) {
+        std::fill(out.begin(), out.end(), m_palette[0]);
+        return;
+    }
+    
+    // 語単位で読み出し、語内のパレット番号を順に取り出す
+    const int perWord = 64 / m_bits_per_block;
+    int index = 0;
+    for (const std::uint64_t word : m_data) {
+        std::uint64_t bits = word;
+        for (int i = 0; i < perWord; ++i) {
+            out[static_cast<std::size_t>(index++)] = m_palette[bits & m_index_mask];
+            bits >>= m_bits_per_block;
+        }
+    }
+}
+
+std::size_t Chunk::GetMemoryUsage() const {
+    return m_palette.capacity() * sizeof(BlockId) +
+           m_palette_counts.capacity() * sizeof(std::uint16_t) +
+           m_data.capacity() * sizeof(std::uint64_t);
+}
+
+std::uint32_t Chunk::GetPaletteIndex(int index) const {
+    if (m_bits_per_block == 0) {
+        return 0;
+    }
+    const std::size_t bitOffset = static_cast<std::size_t>(index) * m_bits_per_block;
+    return static_cast<std::uint32_t>((m_data[bitOffset >> 6] >> (bitOffset & 63)) & m_index_mask);
+}
+
+void Chunk::SetPaletteIndex(int index, std::uint32_t paletteIndex) {
+    WritePacked(m_data, m_bits_per_block, index, paletteIndex);
+}
+
+std::uint32_t Chunk::AcquirePaletteIndex(BlockId block) {
+    std::size_t freeSlot = m_palette.size();
+    for (std::size_t i = 0; i < m_palette.size(); ++i) {
+        if (m_palette_counts[i] == 0) {
+            // 空き項目（同じIDなら優先して再利用）
+            if (m_palette[i] == block || freeSlot == m_palette.size()) {
+                freeSlot = i;
+            }
+        } else if (m_palette[i] == block) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+    
+    ++m_live_palette_entries;
+    if (freeSlot < m_palette.size()) {
+        m_palette[freeSlot] = block;
+        return static_cast<std::uint32_t>(freeSlot);
+    }
+    
+    m_palette.push_back(block);
+    m_palette_counts.push_back(0);
+    const int requiredBits = BitsForPaletteSize(m_palette.size());
+    if (requiredBits > m_bits_per_block) {
+        Repack(requiredBits, false);
+    }
+    return static_cast<std::uint32_t>(m_palette.size() - 1);
+}
+
+void Chunk::Repack(int bitsPerBlock, bool compact) {
+    // 旧パレット番号 → 新パレット番号
+    std::vector<std::uint32_t> remap(m_palette.size());
+    std::vector<BlockId> palette;
+    std::vector<std::uint16_t> counts;
+    if (compact) {
+        palette.reserve(m_live_palette_entries);
+        counts.reserve(m_live_palette_entries);
+        for (std::size_t i = 0; i < m_palette.size(); ++i) {
+            if (m_palette_counts[i] > 0) {
+                remap[i] = static_cast<std::uint32_t>(palette.size());
+                palette.push_back(m_palette[i]);
+                counts.push_back(m_palette_counts[i]);
+            }
+        }
+    } else {
+        for (std::size_t i = 0; i < m_palette.size(); ++i) {
+            remap[i] = static_cast<std::uint32_t>(i);
+        }
+        palette = m_palette;
+        counts = m_palette_counts;
+    }
+    
+    std::vector<std::uint64_t> data(WordCountForBits(bitsPerBlock), 0);
+    if (bitsPerBlock > 0) {
+        for (int i = 0; i < kChunkVolume; ++i) {
+            WritePacked(data, bitsPerBlock, i, remap[GetPaletteIndex(i)]);
+        }
+    }
+    
+    m_palette = std::move(palette);
+    m_palette_counts = std::move(counts);
+    m_data = std::move(data);
+    m_bits_per_block = bitsPerBlock;
+    m_index_mask = bitsPerBlock > 0 ? (std::uint64_t{1} << bitsPerBlock) - 1 : 0;
+}
+
+void Chunk::ShrinkIfSparse() {
+    // 一様になった場合は即座に0ビットへ、それ以外は境界での拡大・縮小の繰り返しを避けるため
+    // 使用種類数の2倍を収容できる幅まで縮小する
+    if (m_live_palette_entries == 1) {
+        Repack(0, true);
+        return;
+    }
+    const int targetBits = BitsForPaletteSize(m_live_palette_entries * 2);
+    if (targetBits < m_bits_per_block) {
+        Repack(targetBits, true);
+    }
+}
+
+int Chunk::BitsForPaletteSize(std::size_t paletteSize) {
+    if (paletteSize <= 1) return 0;
+    if (paletteSize <= 2) return 1;
+    if (paletteSize <= 4) return 2;
+    if (paletteSize <= 16) return 4;
+    if (paletteSize <= 256) return 8;
+    return 16;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "world/ChunkLod.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include "world/BlockRegistry.hpp"
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace BoxelGame {
+
+namespace {
+
+constexpr int GridIndex(int x, int y, int z, int size) {
+    return x + (z + y * size) * size;
+}
+
+// 候補中の立方体ブロックの最頻値（同数は先に現れた方、無ければ空気）
+BlockId MostFrequentCube(const BlockId* candidates, int count) {
+    BlockId best = Blocks::Air;
+    int bestCount = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!IsCubeBlock(candidates[i])) {
+            continue;
+        }
+        const int occurrences = static_cast<int>(std::count(candidates, candidates + count, candidates[i]));
+        if (occurrences > bestCount) {
+            best = candidates[i];
+            bestCount = occurrences;
+        }
+    }
+    return best;
+}
+
+// size³ のグリッドを (size/2)³ へ縮小する（インプレース、出力は先頭に詰める）
+void Downsample2x(std::span<BlockId> grid, int size) {
+    const int half = size / 2;
+    for (int y = 0; y < half; ++y) {
+        for (int z = 0; z < half; ++z) {
+            for (int x = 0; x < half; ++x) {
+                // 出力位置は常に入力位置より前にあり、未読の入力を上書きしない
+                const int x0 = x * 2;
+                const int y0 = y * 2;
+                const int z0 = z * 2;
+                const BlockId upper[4] = {
+                    grid[GridIndex(x0, y0 + 1, z0, size)], grid[GridIndex(x0 + 1, y0 + 1, z0, size)],
+                    grid[GridIndex(x0, y0 + 1, z0 + 1, size)], grid[GridIndex(x0 + 1, y0 + 1, z0 + 1, size)]
+                };
+                const BlockId lower[4] = {
+                    grid[GridIndex(x0, y0, z0, size)], grid[GridIndex(x0 + 1, y0, z0, size)],
+                    grid[GridIndex(x0, y0, z0 + 1, size)], grid[GridIndex(x0 + 1, y0, z0 + 1, size)]
+                };
+                BlockId block = MostFrequentCube(upper, 4);
+                if (block == Blocks::Air) {
+                    block = MostFrequentCube(lower, 4);
+                }
+                grid[GridIndex(x, y, z, half)] = block;
+            }
+        }
+    }
+}
+
+// ComputeLodRevision で数を詰めるビット数（最大レベルの領域のチャンク数を収める）
+constexpr int kLodRevisionCountBits = 10;
+static_assert(GetLodScale(kMaxLodLevel) * GetLodScale(kMaxLodLevel) * GetLodScale(kMaxLodLevel) < (1 << kLodRevisionCountBits));
+
+} // namespace
+
+void DownsampleChunk(const Chunk& chunk, int level, std::span<BlockId> out) {
+    if (level < 0 || level > kMaxLodLevel) {
+        throw BoxelGameException("LODレベルが範囲外です: " + std::to_string(level));
+    }
+    const int size = kChunkSize >> level;
+    const auto cellCount = static_cast<std::size_t>(size * size * size);
+    if (out.size() < cellCount) {
+        throw BoxelGameException("LOD縮小の出力領域が不足しています");
+    }
+    
+    // 一様チャンクは縮小しても一様（保守的な縮小でも種別は変わらない）
+    if (chunk.IsUniform()) {
+        std::fill_n(out.begin(), cellCount, chunk.GetUniformBlock());
+        return;
+    }
+    
+    std::array<BlockId, kChunkVolume> grid{};
+    chunk.Unpack(grid);
+    for (int current = kChunkSize; current > size; current /= 2) {
+        Downsample2x(grid, current);
+    }
+    std::copy_n(grid.begin(), cellCount, out.begin());
+}
+
+void BuildLodChunk(const ChunkManager& chunks, const ChunkCoord& region, int level, PaddedChunk& out) {
+    BOXEL_PROFILE_SCOPE("BuildLodChunk");
+    
+    if (level == 0) {
+        out.Build(chunks.GetNeighborhood(region));
+        return;
+    }
+    
+    out.blocks.fill(Blocks::Air);
+    const int scale = GetLodScale(level);
+    const int cellsPerChunk = kChunkSize / scale;
+    const ChunkCoord origin = GetLodRegionOrigin(region, level);
+    std::array<BlockId, kChunkVolume> cells{};
+    
+    for (int cy = 0; cy < scale; ++cy) {
+        for (int cz = 0; cz < scale; ++cz) {
+            for (int cx = 0; cx < scale; ++cx) {
+                const Chunk* chunk = chunks.Find({origin.x + cx, origin.y + cy, origin.z + cz});
+                if (chunk == nullptr || chunk->IsEmpty()) {
+                    continue;
+                }
+                
+                DownsampleChunk(*chunk, level, cells);
+                for (int y = 0; y < cellsPerChunk; ++y) {
+                    for (int z = 0; z < cellsPerChunk; ++z) {
+                        for (int x = 0; x < cellsPerChunk; ++x) {
+                            out.Set(cx * cellsPerChunk + x, cy * cellsPerChunk + y, cz * cellsPerChunk + z,
+                                    cells[GridIndex(x, y, z, cellsPerChunk)]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+std::uint64_t ComputeLodRevision(const ChunkManager& chunks, const ChunkCoord& region, int level) {
+    // 版は全チャンクで一意に増加するため、変更・ロードがあれば最大の版が必ず増える。
+    // それ以外の変化はアンロードのみで、その場合はロード済みの数が必ず減る。
+    // (最大の版, ロード済みの数) の組はこの2つで変化を取りこぼさない（総和と違い相殺しない）
+    std::uint64_t maxRevision = 0;
+    std::uint64_t loadedCount = 0;
+    const auto accumulate = [&](const ChunkCoord& coord) {
+        if (const Chunk* chunk = chunks.Find(coord)) {
+            maxRevision = std::max(maxRevision, chunk->GetRevision());
+            ++loadedCount;
+        }
+    };
+    
+    if (level == 0) {
+        // レベル0のスナップショットは境界に26近傍を含むため、近傍の変更でも版を変える
+        if (!chunks.Contains(region)) {
+            return 0;
+        }
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    accumulate({region.x + dx, region.y + dy, region.z + dz});
+                }
+            }
+        }
+    } else {
+        const int scale = GetLodScale(level);
+        const ChunkCoord origin = GetLodRegionOrigin(region, level);
+        for (int cy = 0; cy < scale; ++cy) {
+            for (int cz = 0; cz < scale; ++cz) {
+                for (int cx = 0; cx < scale; ++cx) {
+                    accumulate({origin.x + cx, origin.y + cy, origin.z + cz});
+                }
+            }
+        }
+    }
+    
+    if (loadedCount == 0) {
+        return 0;
+    }
+    return (maxRevision << kLodRevisionCountBits) | loadedCount;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
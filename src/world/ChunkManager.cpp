@@ -0,0 +1,165 @@
+#include "world/ChunkManager.hpp"
+#include "core/Exception.hpp"
+#include <algorithm>
+#include <bit>
+#include <string>
+
+namespace BoxelGame {
+
+namespace {
+
+// 最大負荷率 1/2（線形探索の探索長を短く保つ）
+constexpr std::size_t kMaxLoadNumerator = 1;
+constexpr std::size_t kMaxLoadDenominator = 2;
+
+} // namespace
+
+ChunkManager::ChunkManager(std::size_t initialCapacity) {
+    Rehash(std::bit_ceil(std::max<std::size_t>(initialCapacity, 16)));
+}
+
+Chunk& ChunkManager::Insert(const ChunkCoord& coord, std::unique_ptr<Chunk> chunk) {
+    if (!chunk) {
+        throw BoxelGameException("nullのチャンクは登録できません");
+    }
+    if (!IsValidChunkCoord(coord)) {
+        throw BoxelGameException("チャンク座標が範囲外: (" + std::to_string(coord.x) + ", " +
+                                 std::to_string(coord.y) + ", " + std::to_string(coord.z) + ")");
+    }
+    
+    if ((m_count + 1) * kMaxLoadDenominator > m_slots.size() * kMaxLoadNumerator) {
+        Rehash(m_slots.size() * 2);
+    }
+    
+    const std::uint64_t key = PackChunkCoord(coord);
+    const std::size_t mask = m_slots.size() - 1;
+    for (std::size_t i = HomeSlot(key);; i = (i + 1) & mask) {
+        Slot& slot = m_slots[i];
+        if (slot.key == key) {
+            slot.chunk = std::move(chunk);
+            return *slot.chunk;
+        }
+        if (slot.key == kEmptyKey) {
+            slot.key = key;
+            slot.chunk = std::move(chunk);
+            ++m_count;
+            return *slot.chunk;
+        }
+    }
+}
+
+Chunk& ChunkManager::GetOrCreate(const ChunkCoord& coord, BlockId fill) {
+    if (Chunk* chunk = Find(coord)) {
+        return *chunk;
+    }
+    return Insert(coord, std::make_unique<Chunk>(fill));
+}
+
+std::unique_ptr<Chunk> ChunkManager::Remove(const ChunkCoord& coord) {
+    if (!IsValidChunkCoord(coord)) {
+        return nullptr;
+    }
+    const std::uint64_t key = PackChunkCoord(coord);
+    const std::size_t mask = m_slots.size() - 1;
+    
+    std::size_t hole = HomeSlot(key);
+    while (m_slots[hole].key != key) {
+        if (m_slots[hole].key == kEmptyKey) {
+            return nullptr;
+        }
+        hole = (hole + 1) & mask;
+    }
+    
+    std::unique_ptr<Chunk> removed = std::move(m_slots[hole].chunk);
+    m_slots[hole].key = kEmptyKey;
+    --m_count;
+    
+    // 後方シフト削除: 墓標を残さず、後続の探索列を詰める
+    for (std::size_t i = (hole + 1) & mask; m_slots[i].key != kEmptyKey; i = (i + 1) & mask) {
+        const std::size_t home = HomeSlot(m_slots[i].key);
+        // homeが(hole, i]の循環区間内なら移動できない
+        const bool homeBetween = hole <= i ? (hole < home && home <= i) : (hole < home || home <= i);
+        if (!homeBetween) {
+            m_slots[hole] = std::move(m_slots[i]);
+            m_slots[i].key = kEmptyKey;
+            hole = i;
+        }
+    }
+    return removed;
+}
+
+void ChunkManager::Clear() {
+    for (Slot& slot : m_slots) {
+        slot.key = kEmptyKey;
+        slot.chunk.reset();
+    }
+    m_count = 0;
+}
+
+BlockId ChunkManager::GetBlock(int x, int y, int z) const {
+    const Chunk* chunk = Find(BlockToChunkCoord(x, y, z));
+    return chunk ? chunk->Get(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)) : Blocks::Air;
+}
+
+bool ChunkManager::SetBlock(int x, int y, int z, BlockId block) {
+    Chunk* chunk = Find(BlockToChunkCoord(x, y, z));
+    return chunk && chunk->Set(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z), block);
+}
+
+ChunkNeighborhood ChunkManager::GetNeighborhood(const ChunkCoord& center) const {
+    ChunkNeighborhood neighborhood;
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                neighborhood.SetChunk(dx, dy, dz, Find({center.x + dx, center.y + dy, center.z + dz}));
+            }
+        }
+    }
+    return neighborhood;
+}
+
+std::size_t ChunkManager::GetMemoryUsage() const {
+    std::size_t total = 0;
+    ForEach([&total](const ChunkCoord&, const Chunk& chunk) {
+        total += sizeof(Chunk) + chunk.GetMemoryUsage();
+    });
+    return total;
+}
+
+Chunk* ChunkManager::FindByKey(std::uint64_t key) const {
+    const std::size_t mask = m_slots.size() - 1;
+    for (std::size_t i = HomeSlot(key);; i = (i + 1) & mask) {
+        const Slot& slot = m_slots[i];
+        if (slot.key == key) {
+            return slot.chunk.get();
+        }
+        if (slot.key == kEmptyKey) {
+            return nullptr;
+        }
+    }
+}
+
+std::size_t ChunkManager::HomeSlot(std::uint64_t key) const {
+    // フィボナッチハッシュ（隣接座標のキーを表全体へ分散させる）
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> m_shift);
+}
+
+void ChunkManager::Rehash(std::size_t capacity) {
+    std::vector<Slot> old = std::move(m_slots);
+    m_slots = std::vector<Slot>(capacity);
+    m_shift = 64 - std::countr_zero(capacity);
+    
+    const std::size_t mask = capacity - 1;
+    for (Slot& slot : old) {
+        if (slot.key == kEmptyKey) {
+            continue;
+        }
+        std::size_t i = HomeSlot(slot.key);
+        while (m_slots[i].key != kEmptyKey) {
+            i = (i + 1) & mask;
+        }
+        m_slots[i] = std::move(slot);
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
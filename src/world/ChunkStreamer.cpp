@@ -0,0 +1,159 @@
+#include "world/ChunkStreamer.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <tuple>
+
+namespace BoxelGame {
+
+ChunkStreamer::ChunkStreamer(JobSystem& jobSystem, TerrainGenerator& generator, const ChunkStreamingConfig& config)
+    : m_job_system(jobSystem),
+      m_generator(generator),
+      m_config(config),
+      m_completed(std::bit_ceil(std::max<std::size_t>(config.maxJobsInFlight, 2))) {
+    if (config.maxJobsInFlight == 0) {
+        throw InitializationException("ChunkStreamer", "同時実行ジョブ数は1以上を指定");
+    }
+    if (config.viewDistance < 0 || config.firstFrameRadius < 0 || config.minChunkY > config.maxChunkY) {
+        throw InitializationException("ChunkStreamer", "読み込み範囲が不正です");
+    }
+    
+    m_job_storage.reserve(config.maxJobsInFlight);
+    m_free_jobs.reserve(config.maxJobsInFlight);
+    for (std::size_t i = 0; i < config.maxJobsInFlight; ++i) {
+        m_job_storage.push_back(std::make_unique<GenerationJob>());
+        m_free_jobs.push_back(m_job_storage.back().get());
+    }
+    
+    // 列をリング順（同じリング内はスポーン列に近い順）に並べ、各列は上から読み込む
+    struct Column {
+        int ring;
+        int distanceSquared;
+        int dx;
+        int dz;
+    };
+    std::vector<Column> columns;
+    const int radius = config.viewDistance;
+    for (int dz = -radius; dz <= radius; ++dz) {
+        for (int dx = -radius; dx <= radius; ++dx) {
+            columns.push_back({std::max(std::abs(dx), std::abs(dz)), dx * dx + dz * dz, dx, dz});
+        }
+    }
+    std::sort(columns.begin(), columns.end(), [](const Column& a, const Column& b) {
+        return std::tie(a.ring, a.distanceSquared, a.dz, a.dx) < std::tie(b.ring, b.distanceSquared, b.dz, b.dx);
+    });
+    
+    const int height = config.maxChunkY - config.minChunkY + 1;
+    m_order.reserve(columns.size() * static_cast<std::size_t>(height));
+    for (const Column& column : columns) {
+        for (int y = config.maxChunkY; y >= config.minChunkY; --y) {
+            m_order.push_back({config.spawnChunkX + column.dx, y, config.spawnChunkZ + column.dz});
+        }
+        if (column.ring <= config.firstFrameRadius) {
+            m_inner_count += static_cast<std::size_t>(height);
+        }
+    }
+}
+
+ChunkStreamer::~ChunkStreamer() {
+    // ジョブは作業領域と完了キューを参照するため、破棄前に全完了を待つ
+    m_job_system.Wait(m_jobs);
+}
+
+void ChunkStreamer::Update(ChunkManager& chunks, std::vector<ChunkCoord>& loaded, std::vector<ChunkCoord>& meshable) {
+    BOXEL_PROFILE_SCOPE("ChunkStreamer::Update");
+    
+    CollectCompleted(chunks, loaded, meshable);
+    DispatchJobs();
+}
+
+void ChunkStreamer::NotifyMeshed(const ChunkCoord& coord) {
+    const int ring = GetRing(coord);
+    if (ring < 0 || !m_meshed.insert(PackChunkCoord(coord)).second) {
+        return;
+    }
+    if (ring <= m_config.firstFrameRadius) {
+        ++m_inner_meshed;
+    }
+}
+
+bool ChunkStreamer::Contains(const ChunkCoord& coord) const {
+    return GetRing(coord) >= 0;
+}
+
+int ChunkStreamer::GetRing(const ChunkCoord& coord) const {
+    if (coord.y < m_config.minChunkY || coord.y > m_config.maxChunkY) {
+        return -1;
+    }
+    const int ring = std::max(std::abs(coord.x - m_config.spawnChunkX), std::abs(coord.z - m_config.spawnChunkZ));
+    return ring <= m_config.viewDistance ? ring : -1;
+}
+
+bool ChunkStreamer::IsLoadedOrOutside(const ChunkCoord& coord) const {
+    return !Contains(coord) || m_loaded.contains(PackChunkCoord(coord));
+}
+
+void ChunkStreamer::CollectCompleted(ChunkManager& chunks, std::vector<ChunkCoord>& loaded,
+                                     std::vector<ChunkCoord>& meshable) {
+    GenerationJob* job = nullptr;
+    while (m_completed.TryPop(job)) {
+        --m_jobs_in_flight;
+        const ChunkCoord coord = job->coord;
+        chunks.Insert(coord, std::move(job->chunk));
+        m_loaded.insert(PackChunkCoord(coord));
+        loaded.push_back(coord);
+        m_free_jobs.push_back(job);
+        
+        // 新しいチャンクで26近傍が揃ったチャンク（自身を含む）をメッシュ化可能にする
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const ChunkCoord candidate{coord.x + dx, coord.y + dy, coord.z + dz};
+                    const std::uint64_t key = PackChunkCoord(candidate);
+                    if (!m_loaded.contains(key) || m_meshable.contains(key)) {
+                        continue;
+                    }
+                    bool ready = true;
+                    for (int ny = -1; ny <= 1 && ready; ++ny) {
+                        for (int nz = -1; nz <= 1 && ready; ++nz) {
+                            for (int nx = -1; nx <= 1 && ready; ++nx) {
+                                ready = IsLoadedOrOutside({candidate.x + nx, candidate.y + ny, candidate.z + nz});
+                            }
+                        }
+                    }
+                    if (ready) {
+                        m_meshable.insert(key);
+                        meshable.push_back(candidate);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ChunkStreamer::DispatchJobs() {
+    while (m_next < m_order.size() && !m_free_jobs.empty()) {
+        const ChunkCoord coord = m_order[m_next++];
+        
+        GenerationJob* job = m_free_jobs.back();
+        m_free_jobs.pop_back();
+        job->coord = coord;
+        // 高さマップはメインスレッドで求めてキャッシュし、ジョブはキャッシュ（ハッシュ表）に触れない
+        job->column = &m_generator.GetColumn(coord.x, coord.z);
+        if (!job->chunk) {
+            job->chunk = std::make_unique<Chunk>();
+        }
+        
+        ++m_jobs_in_flight;
+        m_job_system.Schedule([this, job] {
+            BOXEL_PROFILE_SCOPE("ChunkStreamer::GenerationJob");
+            m_generator.GenerateChunk(job->coord, *job->column, *job->chunk);
+            // 完了キューの容量は同時実行ジョブ数以上のため失敗しない
+            m_completed.TryPush(job);
+        }, &m_jobs);
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,478 @@
+#include "world/LightEngine.hpp"
+#include "core/Profiler.hpp"
+#include "world/BlockRegistry.hpp"
+
+namespace BoxelGame {
+
+namespace {
+
+// 伝播方向（x, y, z）。下向きは空の光を減衰させずに伝える
+constexpr int kDirectionCount = 6;
+constexpr int kDirections[kDirectionCount][3] = {
+    {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+};
+constexpr int kUp = 2;
+constexpr int kDown = 3;
+
+struct LocalCell {
+    ChunkCoord coord;
+    int index;
+};
+
+// 隣接セル（チャンク境界を越える場合は隣接チャンクの座標へ繰り上げる）
+LocalCell Step(const ChunkCoord& coord, int index, int direction) {
+    int local[3] = {index & (kChunkSize - 1), index >> (kChunkSizeLog2 * 2), (index >> kChunkSizeLog2) & (kChunkSize - 1)};
+    int chunk[3] = {coord.x, coord.y, coord.z};
+    for (int axis = 0; axis < 3; ++axis) {
+        local[axis] += kDirections[direction][axis];
+        if (local[axis] < 0) {
+            local[axis] += kChunkSize;
+            --chunk[axis];
+        } else if (local[axis] >= kChunkSize) {
+            local[axis] -= kChunkSize;
+            ++chunk[axis];
+        }
+    }
+    return {{chunk[0], chunk[1], chunk[2]}, ToChunkIndex(local[0], local[1], local[2])};
+}
+
+// チャンク内で隣接セルがあれば返す（境界を越える場合は-1）
+int StepInside(int index, int direction) {
+    const int local[3] = {
+        (index & (kChunkSize - 1)) + kDirections[direction][0],
+        (index >> (kChunkSizeLog2 * 2)) + kDirections[direction][1],
+        ((index >> kChunkSizeLog2) & (kChunkSize - 1)) + kDirections[direction][2]
+    };
+    for (const int value : local) {
+        if (value < 0 || value >= kChunkSize) {
+            return -1;
+        }
+    }
+    return ToChunkIndex(local[0], local[1], local[2]);
+}
+
+std::uint8_t PropagatedLevel(LightChannel channel, int direction, std::uint8_t level) {
+    if (channel == LightChannel::Sky && direction == kDown && level == kMaxLightLevel) {
+        return kMaxLightLevel;
+    }
+    return static_cast<std::uint8_t>(level - 1);
+}
+
+// チャンク内のみで伝播する
+void FloodInside(const std::array<BlockId, kChunkVolume>& blocks, LightChannel channel, ChunkLight& light,
+                 std::vector<std::uint16_t>& queue) {
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const int index = queue[head];
+        const std::uint8_t level = light.Get(channel, index);
+        if (level <= 1) {
+            continue;
+        }
+        for (int direction = 0; direction < kDirectionCount; ++direction) {
+            const int neighbor = StepInside(index, direction);
+            if (neighbor < 0 || IsOpaqueBlock(blocks[neighbor])) {
+                continue;
+            }
+            const std::uint8_t propagated = PropagatedLevel(channel, direction, level);
+            if (light.Get(channel, neighbor) < propagated) {
+                light.Set(channel, neighbor, propagated);
+                queue.push_back(static_cast<std::uint16_t>(neighbor));
+            }
+        }
+    }
+    queue.clear();
+}
+
+// チャンク単体の初期ライティング（ジョブから呼ばれる。他チャンクへは書き込まない）
+// above: 上方チャンクの光量（無ければopenSkyに従い最大光量または0が上から届く）
+void LightChunkInterior(const Chunk& chunk, const ChunkLight* above, bool openSky, ChunkLight& out) {
+    BOXEL_PROFILE_SCOPE("LightEngine::LightChunkInterior");
+    
+    thread_local std::array<BlockId, kChunkVolume> blocks;
+    thread_local std::vector<std::uint16_t> queue;
+    chunk.Unpack(blocks);
+    out = ChunkLight{};
+    
+    // 空の光: 列ごとに上から落とす
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int x = 0; x < kChunkSize; ++x) {
+            std::uint8_t incoming = 0;
+            if (above != nullptr) {
+                incoming = above->Get(LightChannel::Sky, ToChunkIndex(x, 0, z));
+            } else if (openSky) {
+                incoming = kMaxLightLevel;
+            }
+            for (int y = kChunkSize - 1; y >= 0; --y) {
+                const int index = ToChunkIndex(x, y, z);
+                if (IsOpaqueBlock(blocks[index])) {
+                    incoming = 0;
+                    continue;
+                }
+                incoming = incoming == 0 ? 0 : PropagatedLevel(LightChannel::Sky, kDown, incoming);
+                out.Set(LightChannel::Sky, index, incoming);
+            }
+        }
+    }
+    for (int index = 0; index < kChunkVolume; ++index) {
+        if (out.Get(LightChannel::Sky, index) > 1) {
+            queue.push_back(static_cast<std::uint16_t>(index));
+        }
+    }
+    FloodInside(blocks, LightChannel::Sky, out, queue);
+    
+    // ブロックの光: 発光ブロックから広げる
+    for (int index = 0; index < kChunkVolume; ++index) {
+        if (const std::uint8_t emission = GetBlockLightEmission(blocks[index]); emission > 0) {
+            out.Set(LightChannel::Block, index, emission);
+            queue.push_back(static_cast<std::uint16_t>(index));
+        }
+    }
+    FloodInside(blocks, LightChannel::Block, out, queue);
+}
+
+// チャンクの1面（direction側の境界層）のセルを列挙する
+template <typename Function>
+void ForEachBoundaryCell(int direction, const Function& function) {
+    const int axis = direction / 2;
+    const int layer = kDirections[direction][axis] > 0 ? kChunkSize - 1 : 0;
+    for (int b = 0; b < kChunkSize; ++b) {
+        for (int a = 0; a < kChunkSize; ++a) {
+            int local[3] = {a, b, 0};
+            if (axis == 0) {
+                local[0] = layer;
+                local[1] = a;
+                local[2] = b;
+            } else if (axis == 1) {
+                local[0] = a;
+                local[1] = layer;
+                local[2] = b;
+            } else {
+                local[0] = a;
+                local[1] = b;
+                local[2] = layer;
+            }
+            function(ToChunkIndex(local[0], local[1], local[2]));
+        }
+    }
+}
+
+constexpr LightChannel kChannels[kLightChannelCount] = {LightChannel::Sky, LightChannel::Block};
+
+} // namespace
+
+LightEngine::LightEngine(const ChunkManager& chunks)
+    : m_chunks(chunks) {
+}
+
+void LightEngine::LightNewChunks(JobSystem& jobs, std::span<const ChunkCoord> coords,
+                                 std::pmr::memory_resource* scratch) {
+    BOXEL_PROFILE_SCOPE("LightEngine::LightNewChunks");
+    
+    InvalidateCache();
+    m_last_visited = 0;
+    
+    struct Task {
+        ChunkCoord coord;
+        const Chunk* chunk = nullptr;
+        ChunkLight* light = nullptr;
+        const ChunkLight* above = nullptr;
+        bool openSky = false;
+    };
+    std::pmr::vector<Task> tasks(scratch);
+    std::pmr::unordered_set<std::uint64_t> batch(scratch);
+    tasks.reserve(coords.size());
+    
+    // 光量データの確保はメインスレッドで行い、ジョブはそれぞれのチャンクにのみ書き込む
+    for (const ChunkCoord& coord : coords) {
+        const std::uint64_t key = PackChunkCoord(coord);
+        const Chunk* chunk = m_chunks.Find(coord);
+        if (chunk == nullptr || m_lights.contains(key) || !batch.insert(key).second) {
+            continue;
+        }
+        std::unique_ptr<ChunkLight>& light = m_lights[key];
+        light = std::make_unique<ChunkLight>();
+        tasks.push_back({coord, chunk, light.get()});
+    }
+    for (Task& task : tasks) {
+        const ChunkCoord above{task.coord.x, task.coord.y + 1, task.coord.z};
+        if (batch.contains(PackChunkCoord(above))) {
+            // 同じバッチの上方チャンクからの光はチャンク間の伝播で届ける
+            continue;
+        }
+        task.above = Resolve(above).light;
+        task.openSky = task.above == nullptr;
+    }
+    
+    jobs.ParallelFor(tasks.size(), 1, [&tasks](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            LightChunkInterior(*tasks[i].chunk, tasks[i].above, tasks[i].openSky, *tasks[i].light);
+        }
+    });
+    
+    // 開けた空として照らされていた下方チャンクは、新しいチャンクが遮る列の空の光を取り除く
+    for (const Task& task : tasks) {
+        const ChunkCoord below{task.coord.x, task.coord.y - 1, task.coord.z};
+        if (batch.contains(PackChunkCoord(below))) {
+            continue;
+        }
+        const CellRef ref = Resolve(below);
+        if (ref.light == nullptr) {
+            continue;
+        }
+        for (int z = 0; z < kChunkSize; ++z) {
+            for (int x = 0; x < kChunkSize; ++x) {
+                const int top = ToChunkIndex(x, kChunkSize - 1, z);
+                if (ref.light->Get(LightChannel::Sky, top) == kMaxLightLevel &&
+                    task.light->Get(LightChannel::Sky, ToChunkIndex(x, 0, z)) < kMaxLightLevel) {
+                    SetLight(LightChannel::Sky, below, ref, top, 0);
+                    m_remove_queues[static_cast<int>(LightChannel::Sky)].push_back({below, static_cast<std::uint16_t>(top), kMaxLightLevel});
+                }
+            }
+        }
+    }
+    PropagateRemovals(LightChannel::Sky);
+    
+    // チャンク間の伝播: 新しいチャンクの境界と、隣接チャンクの新しいチャンク側の境界から広げる
+    for (const Task& task : tasks) {
+        MarkChanged(task.coord);
+        for (int direction = 0; direction < kDirectionCount; ++direction) {
+            ForEachBoundaryCell(direction, [&](int index) {
+                for (const LightChannel channel : kChannels) {
+                    if (const std::uint8_t level = task.light->Get(channel, index); level > 1) {
+                        m_add_queues[static_cast<int>(channel)].push_back({task.coord, static_cast<std::uint16_t>(index), level});
+                    }
+                }
+            });
+            
+            const ChunkCoord neighbor{task.coord.x + kDirections[direction][0], task.coord.y + kDirections[direction][1],
+                                      task.coord.z + kDirections[direction][2]};
+            if (batch.contains(PackChunkCoord(neighbor))) {
+                continue;
+            }
+            const CellRef ref = Resolve(neighbor);
+            if (ref.light == nullptr) {
+                continue;
+            }
+            const int facing = direction ^ 1;  // 隣接チャンク側から見た新しいチャンクの方向
+            ForEachBoundaryCell(facing, [&](int index) {
+                for (const LightChannel channel : kChannels) {
+                    if (const std::uint8_t level = ref.light->Get(channel, index); level > 1) {
+                        m_add_queues[static_cast<int>(channel)].push_back({neighbor, static_cast<std::uint16_t>(index), level});
+                    }
+                }
+            });
+        }
+    }
+    for (const LightChannel channel : kChannels) {
+        PropagateAdditions(channel);
+    }
+    FinishPass();
+}
+
+void LightEngine::RemoveChunk(const ChunkCoord& coord) {
+    m_lights.erase(PackChunkCoord(coord));
+    InvalidateCache();
+}
+
+void LightEngine::MarkBlockChanged(int x, int y, int z) {
+    m_edits.push_back({x, y, z});
+}
+
+void LightEngine::Update() {
+    BOXEL_PROFILE_SCOPE("LightEngine::Update");
+    
+    InvalidateCache();
+    m_last_visited = 0;
+    if (m_edits.empty()) {
+        FinishPass();
+        return;
+    }
+    
+    // 1. 変更箇所の光を消し、それに依存していた光を除去する
+    for (const BlockPosition& edit : m_edits) {
+        const ChunkCoord coord = BlockToChunkCoord(edit.x, edit.y, edit.z);
+        const int index = ToChunkIndex(BlockToLocal(edit.x), BlockToLocal(edit.y), BlockToLocal(edit.z));
+        const CellRef ref = Resolve(coord);
+        if (ref.light == nullptr) {
+            continue;
+        }
+        for (const LightChannel channel : kChannels) {
+            if (const std::uint8_t level = ref.light->Get(channel, index); level > 0) {
+                SetLight(channel, coord, ref, index, 0);
+                m_remove_queues[static_cast<int>(channel)].push_back({coord, static_cast<std::uint16_t>(index), level});
+            }
+        }
+    }
+    for (const LightChannel channel : kChannels) {
+        PropagateRemovals(channel);
+    }
+    
+    // 2. 新しい光源と、透過になった変更箇所へ周囲から流れ込む光を追加する
+    for (const BlockPosition& edit : m_edits) {
+        const ChunkCoord coord = BlockToChunkCoord(edit.x, edit.y, edit.z);
+        const int index = ToChunkIndex(BlockToLocal(edit.x), BlockToLocal(edit.y), BlockToLocal(edit.z));
+        const CellRef ref = Resolve(coord);
+        if (ref.light == nullptr) {
+            continue;
+        }
+        
+        const BlockId block = ref.chunk->GetByIndex(index);
+        const std::uint8_t emission = GetBlockLightEmission(block);
+        if (emission > ref.light->Get(LightChannel::Block, index)) {
+            SetLight(LightChannel::Block, coord, ref, index, emission);
+            m_add_queues[static_cast<int>(LightChannel::Block)].push_back({coord, static_cast<std::uint16_t>(index), emission});
+        }
+        if (IsOpaqueBlock(block)) {
+            continue;
+        }
+        
+        for (int direction = 0; direction < kDirectionCount; ++direction) {
+            const LocalCell neighbor = Step(coord, index, direction);
+            const CellRef neighborRef = Resolve(neighbor.coord);
+            if (neighborRef.light == nullptr) {
+                // 未ライティングの上方は開けた空
+                if (direction == kUp && ref.light->Get(LightChannel::Sky, index) < kMaxLightLevel) {
+                    SetLight(LightChannel::Sky, coord, ref, index, kMaxLightLevel);
+                    m_add_queues[static_cast<int>(LightChannel::Sky)].push_back({coord, static_cast<std::uint16_t>(index), kMaxLightLevel});
+                }
+                continue;
+            }
+            for (const LightChannel channel : kChannels) {
+                if (const std::uint8_t level = neighborRef.light->Get(channel, neighbor.index); level > 1) {
+                    m_add_queues[static_cast<int>(channel)].push_back({neighbor.coord, static_cast<std::uint16_t>(neighbor.index), level});
+                }
+            }
+        }
+    }
+    for (const LightChannel channel : kChannels) {
+        PropagateAdditions(channel);
+    }
+    
+    m_edits.clear();
+    FinishPass();
+}
+
+std::uint8_t LightEngine::GetLight(LightChannel channel, int x, int y, int z) const {
+    const ChunkLight* light = FindChunkLight(BlockToChunkCoord(x, y, z));
+    if (light == nullptr) {
+        return 0;
+    }
+    return light->Get(channel, ToChunkIndex(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)));
+}
+
+const ChunkLight* LightEngine::FindChunkLight(const ChunkCoord& coord) const {
+    const auto it = m_lights.find(PackChunkCoord(coord));
+    return it != m_lights.end() ? it->second.get() : nullptr;
+}
+
+LightEngine::CellRef LightEngine::Resolve(const ChunkCoord& coord) {
+    const std::uint64_t key = PackChunkCoord(coord);
+    if (m_cache_valid && m_cached_key == key) {
+        return m_cached_ref;
+    }
+    
+    CellRef ref;
+    if (const auto it = m_lights.find(key); it != m_lights.end()) {
+        ref.chunk = m_chunks.Find(coord);
+        ref.light = ref.chunk != nullptr ? it->second.get() : nullptr;
+    }
+    m_cached_key = key;
+    m_cached_ref = ref;
+    m_cache_valid = true;
+    return ref;
+}
+
+void LightEngine::MarkChanged(const ChunkCoord& coord) {
+    const std::uint64_t key = PackChunkCoord(coord);
+    if (!m_has_last_changed || m_last_changed_key != key) {
+        m_changed_keys.insert(key);
+        m_last_changed_key = key;
+        m_has_last_changed = true;
+    }
+}
+
+void LightEngine::SetLight(LightChannel channel, const ChunkCoord& coord, const CellRef& ref, int index,
+                           std::uint8_t level) {
+    ref.light->Set(channel, index, level);
+    MarkChanged(coord);
+}
+
+void LightEngine::PropagateRemovals(LightChannel channel) {
+    auto& queue = m_remove_queues[static_cast<int>(channel)];
+    auto& additions = m_add_queues[static_cast<int>(channel)];
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const LightNode node = queue[head];
+        ++m_last_visited;
+        for (int direction = 0; direction < kDirectionCount; ++direction) {
+            const LocalCell neighbor = Step(node.coord, node.index, direction);
+            const CellRef ref = Resolve(neighbor.coord);
+            if (ref.light == nullptr) {
+                continue;
+            }
+            const std::uint8_t level = ref.light->Get(channel, neighbor.index);
+            if (level == 0) {
+                continue;
+            }
+            
+            // このセルから届いていた光は消して更に辿り、それ以外の光は再伝播の起点にする
+            const bool dependent = level < node.level ||
+                (channel == LightChannel::Sky && direction == kDown && node.level == kMaxLightLevel);
+            if (!dependent) {
+                additions.push_back({neighbor.coord, static_cast<std::uint16_t>(neighbor.index), level});
+                continue;
+            }
+            SetLight(channel, neighbor.coord, ref, neighbor.index, 0);
+            queue.push_back({neighbor.coord, static_cast<std::uint16_t>(neighbor.index), level});
+            
+            // 消した範囲にある発光ブロックは自身の光を取り戻す
+            if (channel == LightChannel::Block) {
+                if (const std::uint8_t emission = GetBlockLightEmission(ref.chunk->GetByIndex(neighbor.index)); emission > 0) {
+                    SetLight(channel, neighbor.coord, ref, neighbor.index, emission);
+                    additions.push_back({neighbor.coord, static_cast<std::uint16_t>(neighbor.index), emission});
+                }
+            }
+        }
+    }
+    queue.clear();
+}
+
+void LightEngine::PropagateAdditions(LightChannel channel) {
+    auto& queue = m_add_queues[static_cast<int>(channel)];
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const LightNode node = queue[head];
+        const CellRef ref = Resolve(node.coord);
+        if (ref.light == nullptr) {
+            continue;
+        }
+        // キューに入った後により明るくなっている場合もあるため、現在の光量から広げる
+        const std::uint8_t level = ref.light->Get(channel, node.index);
+        if (level <= 1) {
+            continue;
+        }
+        ++m_last_visited;
+        
+        for (int direction = 0; direction < kDirectionCount; ++direction) {
+            const LocalCell neighbor = Step(node.coord, node.index, direction);
+            const CellRef neighborRef = Resolve(neighbor.coord);
+            if (neighborRef.light == nullptr || IsOpaqueBlock(neighborRef.chunk->GetByIndex(neighbor.index))) {
+                continue;
+            }
+            const std::uint8_t propagated = PropagatedLevel(channel, direction, level);
+            if (neighborRef.light->Get(channel, neighbor.index) < propagated) {
+                SetLight(channel, neighbor.coord, neighborRef, neighbor.index, propagated);
+                queue.push_back({neighbor.coord, static_cast<std::uint16_t>(neighbor.index), propagated});
+            }
+        }
+    }
+    queue.clear();
+}
+
+void LightEngine::FinishPass() {
+    m_changed_chunks.clear();
+    for (const std::uint64_t key : m_changed_keys) {
+        m_changed_chunks.push_back(UnpackChunkCoord(key));
+    }
+    m_changed_keys.clear();
+    m_has_last_changed = false;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,276 @@
+#include "world/Noise.hpp"
+#include "world/SimplexKernel.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#if BOXEL_NOISE_X86 && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace BoxelGame {
+
+namespace {
+
+// 1点ずつ評価する実装（SIMD版と同じ演算順序）
+struct ScalarOps {
+    using F = float;
+    using I = std::uint32_t;
+    static constexpr std::size_t kWidth = 1;
+    
+    static F SetF(float value) { return value; }
+    static I SetI(std::int32_t value) { return static_cast<I>(value); }
+    static F Load(const float* source) { return *source; }
+    static void Store(float* destination, F value) { *destination = value; }
+    
+    static F Add(F a, F b) { return a + b; }
+    static F Sub(F a, F b) { return a - b; }
+    static F Mul(F a, F b) { return a * b; }
+    static F Max(F a, F b) { return a > b ? a : b; }
+    static F Floor(F value) { return std::floor(value); }
+    static I ToInt(F value) { return static_cast<I>(static_cast<std::int32_t>(value)); }
+    static I CmpGe(F a, F b) { return a >= b ? ~I{0} : I{0}; }
+    static F Select(I mask, F a, F b) { return mask != 0 ? a : b; }
+    static F MaskF(I mask, F value) { return std::bit_cast<F>(mask & std::bit_cast<I>(value)); }
+    static F FlipSign(F value, I bits) { return std::bit_cast<F>(std::bit_cast<I>(value) ^ (bits & 0x80000000u)); }
+    
+    static I IAdd(I a, I b) { return a + b; }
+    static I ISub(I a, I b) { return a - b; }
+    static I IMul(I a, I b) { return a * b; }
+    static I IAnd(I a, I b) { return a & b; }
+    static I IOr(I a, I b) { return a | b; }
+    static I IXor(I a, I b) { return a ^ b; }
+    static I INot(I value) { return ~value; }
+    static I ICmpLt(I a, I b) { return static_cast<std::int32_t>(a) < static_cast<std::int32_t>(b) ? ~I{0} : I{0}; }
+    static I ICmpEq(I a, I b) { return a == b ? ~I{0} : I{0}; }
+    template <int Bits>
+    static I ShiftRight(I value) { return value >> Bits; }
+    template <int Bits>
+    static I ShiftLeft(I value) { return value << Bits; }
+};
+
+NoiseBackend DetectBestBackend() {
+#if BOXEL_NOISE_X86 && defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 1);
+    const bool sse41 = (info[2] & (1 << 19)) != 0;
+    // AVX2はOSがYMMレジスタを保存する場合のみ使える
+    const bool osAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    const bool avx2 = osAvx && (info[1] & (1 << 5)) != 0;
+#elif BOXEL_NOISE_X86
+    __builtin_cpu_init();
+    const bool sse41 = __builtin_cpu_supports("sse4.1");
+    const bool avx2 = __builtin_cpu_supports("avx2");
+#else
+    const bool sse41 = false;
+    const bool avx2 = false;
+#endif
+    if (avx2) {
+        return NoiseBackend::Avx2;
+    }
+    return sse41 ? NoiseBackend::Sse41 : NoiseBackend::Scalar;
+}
+
+void RequireSupported(NoiseBackend backend) {
+    if (!IsNoiseBackendSupported(backend)) {
+        throw BoxelGameException(std::string("ノイズの命令セットに対応していません: ") + GetNoiseBackendName(backend));
+    }
+}
+
+// out[i] += amplitude × noise（SIMDの幅に満たない端数はスカラー版で処理する）
+void AccumulateNoise2D(NoiseBackend backend, const float* x, const float* y, float* out, std::size_t count,
+                       std::uint32_t seed, float amplitude) {
+    std::size_t done = 0;
+#if BOXEL_NOISE_X86
+    if (backend == NoiseBackend::Avx2) {
+        done = NoiseKernels::AccumulateSimplex2Avx2(x, y, out, count, seed, amplitude);
+    } else if (backend == NoiseBackend::Sse41) {
+        done = NoiseKernels::AccumulateSimplex2Sse41(x, y, out, count, seed, amplitude);
+    }
+#else
+    (void)backend;
+#endif
+    AccumulateSimplex2<ScalarOps>(x + done, y + done, out + done, count - done, seed, amplitude);
+}
+
+void AccumulateNoise3D(NoiseBackend backend, const float* x, const float* y, const float* z, float* out,
+                       std::size_t count, std::uint32_t seed, float amplitude) {
+    std::size_t done = 0;
+#if BOXEL_NOISE_X86
+    if (backend == NoiseBackend::Avx2) {
+        done = NoiseKernels::AccumulateSimplex3Avx2(x, y, z, out, count, seed, amplitude);
+    } else if (backend == NoiseBackend::Sse41) {
+        done = NoiseKernels::AccumulateSimplex3Sse41(x, y, z, out, count, seed, amplitude);
+    }
+#else
+    (void)backend;
+#endif
+    AccumulateSimplex3<ScalarOps>(x + done, y + done, z + done, out + done, count - done, seed, amplitude);
+}
+
+void ValidateFractalSettings(const FractalNoiseSettings& settings, std::size_t count, std::size_t outSize) {
+    if (settings.octaves < 1) {
+        throw BoxelGameException("fBmのオクターブ数は1以上である必要があります: " + std::to_string(settings.octaves));
+    }
+    if (outSize < count) {
+        throw BoxelGameException("ノイズ格子の出力領域が不足しています");
+    }
+}
+
+// 振幅の総和の逆数（出力を[-1, 1]程度へ正規化する）
+float ComputeAmplitudeNormalizer(const FractalNoiseSettings& settings) {
+    float amplitude = 1.0f;
+    float total = 0.0f;
+    for (int octave = 0; octave < settings.octaves; ++octave) {
+        total += amplitude;
+        amplitude *= settings.gain;
+    }
+    return total > 0.0f ? 1.0f / total : 0.0f;
+}
+
+// 格子座標の作業領域（生成ジョブのワーカーごとに使い回す）
+struct GridScratch {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    
+    void Resize(std::size_t count) {
+        x.resize(count);
+        y.resize(count);
+        z.resize(count);
+    }
+};
+
+GridScratch& GetGridScratch() {
+    thread_local GridScratch scratch;
+    return scratch;
+}
+
+} // namespace
+
+const char* GetNoiseBackendName(NoiseBackend backend) {
+    switch (backend) {
+    case NoiseBackend::Scalar:
+        return "Scalar";
+    case NoiseBackend::Sse41:
+        return "SSE4.1";
+    case NoiseBackend::Avx2:
+        return "AVX2";
+    }
+    return "Unknown";
+}
+
+bool IsNoiseBackendSupported(NoiseBackend backend) {
+    return static_cast<int>(backend) <= static_cast<int>(GetBestNoiseBackend());
+}
+
+NoiseBackend GetBestNoiseBackend() {
+    static const NoiseBackend best = DetectBestBackend();
+    return best;
+}
+
+float SimplexNoise2D(float x, float y, std::uint32_t seed) {
+    return Simplex2<ScalarOps>(x, y, seed);
+}
+
+float SimplexNoise3D(float x, float y, float z, std::uint32_t seed) {
+    return Simplex3<ScalarOps>(x, y, z, seed);
+}
+
+void SimplexNoise2D(std::span<const float> x, std::span<const float> y, std::span<float> out, std::uint32_t seed,
+                    NoiseBackend backend) {
+    if (x.size() != out.size() || y.size() != out.size()) {
+        throw BoxelGameException("ノイズの入力と出力の長さが一致しません");
+    }
+    RequireSupported(backend);
+    std::fill(out.begin(), out.end(), 0.0f);
+    AccumulateNoise2D(backend, x.data(), y.data(), out.data(), out.size(), seed, 1.0f);
+}
+
+void SimplexNoise3D(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                    std::span<float> out, std::uint32_t seed, NoiseBackend backend) {
+    if (x.size() != out.size() || y.size() != out.size() || z.size() != out.size()) {
+        throw BoxelGameException("ノイズの入力と出力の長さが一致しません");
+    }
+    RequireSupported(backend);
+    std::fill(out.begin(), out.end(), 0.0f);
+    AccumulateNoise3D(backend, x.data(), y.data(), z.data(), out.data(), out.size(), seed, 1.0f);
+}
+
+void FractalNoise2DGrid(const FractalNoiseSettings& settings, int originX, int originZ, int sizeX, int sizeZ,
+                        std::span<float> out, NoiseBackend backend) {
+    BOXEL_PROFILE_SCOPE("FractalNoise2DGrid");
+    
+    const auto count = static_cast<std::size_t>(std::max(sizeX, 0)) * static_cast<std::size_t>(std::max(sizeZ, 0));
+    ValidateFractalSettings(settings, count, out.size());
+    RequireSupported(backend);
+    std::fill_n(out.begin(), count, 0.0f);
+    
+    GridScratch& scratch = GetGridScratch();
+    scratch.Resize(count);
+    float frequency = settings.frequency;
+    float amplitude = 1.0f;
+    for (int octave = 0; octave < settings.octaves; ++octave) {
+        std::size_t index = 0;
+        for (int z = 0; z < sizeZ; ++z) {
+            for (int x = 0; x < sizeX; ++x, ++index) {
+                scratch.x[index] = static_cast<float>(originX + x) * frequency;
+                scratch.z[index] = static_cast<float>(originZ + z) * frequency;
+            }
+        }
+        // オクターブごとにシードを変え、格子点が重なっても相関しないようにする
+        AccumulateNoise2D(backend, scratch.x.data(), scratch.z.data(), out.data(), count,
+                          settings.seed + static_cast<std::uint32_t>(octave), amplitude);
+        frequency *= settings.lacunarity;
+        amplitude *= settings.gain;
+    }
+    
+    const float normalizer = ComputeAmplitudeNormalizer(settings);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] *= normalizer;
+    }
+}
+
+void FractalNoise3DGrid(const FractalNoiseSettings& settings, int originX, int originY, int originZ,
+                        int sizeX, int sizeY, int sizeZ, std::span<float> out, NoiseBackend backend) {
+    BOXEL_PROFILE_SCOPE("FractalNoise3DGrid");
+    
+    const auto count = static_cast<std::size_t>(std::max(sizeX, 0)) * static_cast<std::size_t>(std::max(sizeY, 0)) *
+                       static_cast<std::size_t>(std::max(sizeZ, 0));
+    ValidateFractalSettings(settings, count, out.size());
+    RequireSupported(backend);
+    std::fill_n(out.begin(), count, 0.0f);
+    
+    GridScratch& scratch = GetGridScratch();
+    scratch.Resize(count);
+    float frequency = settings.frequency;
+    float amplitude = 1.0f;
+    for (int octave = 0; octave < settings.octaves; ++octave) {
+        std::size_t index = 0;
+        for (int y = 0; y < sizeY; ++y) {
+            for (int z = 0; z < sizeZ; ++z) {
+                for (int x = 0; x < sizeX; ++x, ++index) {
+                    scratch.x[index] = static_cast<float>(originX + x) * frequency;
+                    scratch.y[index] = static_cast<float>(originY + y) * frequency;
+                    scratch.z[index] = static_cast<float>(originZ + z) * frequency;
+                }
+            }
+        }
+        AccumulateNoise3D(backend, scratch.x.data(), scratch.y.data(), scratch.z.data(), out.data(), count,
+                          settings.seed + static_cast<std::uint32_t>(octave), amplitude);
+        frequency *= settings.lacunarity;
+        amplitude *= settings.gain;
+    }
+    
+    const float normalizer = ComputeAmplitudeNormalizer(settings);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] *= normalizer;
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
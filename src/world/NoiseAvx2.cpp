@@ -0,0 +1,67 @@
+// AVX2版のシンプレックスノイズ（このファイルのみAVX2を有効にしてコンパイルする）
+#include "world/SimplexKernel.hpp"
+
+#if BOXEL_NOISE_X86
+#include <immintrin.h>
+
+namespace BoxelGame {
+
+namespace {
+
+struct Avx2Ops {
+    using F = __m256;
+    using I = __m256i;
+    static constexpr std::size_t kWidth = 8;
+    
+    static F SetF(float value) { return _mm256_set1_ps(value); }
+    static I SetI(std::int32_t value) { return _mm256_set1_epi32(value); }
+    static F Load(const float* source) { return _mm256_loadu_ps(source); }
+    static void Store(float* destination, F value) { _mm256_storeu_ps(destination, value); }
+    
+    static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static F Max(F a, F b) { return _mm256_max_ps(a, b); }
+    static F Floor(F value) { return _mm256_floor_ps(value); }
+    static I ToInt(F value) { return _mm256_cvttps_epi32(value); }
+    static I CmpGe(F a, F b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+    static F Select(I mask, F a, F b) { return _mm256_blendv_ps(b, a, _mm256_castsi256_ps(mask)); }
+    static F MaskF(I mask, F value) { return _mm256_and_ps(_mm256_castsi256_ps(mask), value); }
+    static F FlipSign(F value, I bits) {
+        return _mm256_xor_ps(value, _mm256_castsi256_ps(_mm256_and_si256(bits, _mm256_set1_epi32(INT32_MIN))));
+    }
+    
+    static I IAdd(I a, I b) { return _mm256_add_epi32(a, b); }
+    static I ISub(I a, I b) { return _mm256_sub_epi32(a, b); }
+    static I IMul(I a, I b) { return _mm256_mullo_epi32(a, b); }
+    static I IAnd(I a, I b) { return _mm256_and_si256(a, b); }
+    static I IOr(I a, I b) { return _mm256_or_si256(a, b); }
+    static I IXor(I a, I b) { return _mm256_xor_si256(a, b); }
+    static I INot(I value) { return _mm256_xor_si256(value, _mm256_set1_epi32(-1)); }
+    static I ICmpLt(I a, I b) { return _mm256_cmpgt_epi32(b, a); }
+    static I ICmpEq(I a, I b) { return _mm256_cmpeq_epi32(a, b); }
+    template <int Bits>
+    static I ShiftRight(I value) { return _mm256_srli_epi32(value, Bits); }
+    template <int Bits>
+    static I ShiftLeft(I value) { return _mm256_slli_epi32(value, Bits); }
+};
+
+} // namespace
+
+namespace NoiseKernels {
+
+std::size_t AccumulateSimplex2Avx2(const float* x, const float* y, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude) {
+    return AccumulateSimplex2<Avx2Ops>(x, y, out, count, seed, amplitude);
+}
+
+std::size_t AccumulateSimplex3Avx2(const float* x, const float* y, const float* z, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude) {
+    return AccumulateSimplex3<Avx2Ops>(x, y, z, out, count, seed, amplitude);
+}
+
+} // namespace NoiseKernels
+
+} // namespace BoxelGame
+
+#endif
\ No newline at end of file
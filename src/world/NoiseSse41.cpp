@@ -0,0 +1,67 @@
+// SSE4.1版のシンプレックスノイズ（このファイルのみSSE4.1を有効にしてコンパイルする）
+#include "world/SimplexKernel.hpp"
+
+#if BOXEL_NOISE_X86
+#include <immintrin.h>
+
+namespace BoxelGame {
+
+namespace {
+
+struct Sse41Ops {
+    using F = __m128;
+    using I = __m128i;
+    static constexpr std::size_t kWidth = 4;
+    
+    static F SetF(float value) { return _mm_set1_ps(value); }
+    static I SetI(std::int32_t value) { return _mm_set1_epi32(value); }
+    static F Load(const float* source) { return _mm_loadu_ps(source); }
+    static void Store(float* destination, F value) { _mm_storeu_ps(destination, value); }
+    
+    static F Add(F a, F b) { return _mm_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static F Max(F a, F b) { return _mm_max_ps(a, b); }
+    static F Floor(F value) { return _mm_floor_ps(value); }
+    static I ToInt(F value) { return _mm_cvttps_epi32(value); }
+    static I CmpGe(F a, F b) { return _mm_castps_si128(_mm_cmpge_ps(a, b)); }
+    static F Select(I mask, F a, F b) { return _mm_blendv_ps(b, a, _mm_castsi128_ps(mask)); }
+    static F MaskF(I mask, F value) { return _mm_and_ps(_mm_castsi128_ps(mask), value); }
+    static F FlipSign(F value, I bits) {
+        return _mm_xor_ps(value, _mm_castsi128_ps(_mm_and_si128(bits, _mm_set1_epi32(INT32_MIN))));
+    }
+    
+    static I IAdd(I a, I b) { return _mm_add_epi32(a, b); }
+    static I ISub(I a, I b) { return _mm_sub_epi32(a, b); }
+    static I IMul(I a, I b) { return _mm_mullo_epi32(a, b); }
+    static I IAnd(I a, I b) { return _mm_and_si128(a, b); }
+    static I IOr(I a, I b) { return _mm_or_si128(a, b); }
+    static I IXor(I a, I b) { return _mm_xor_si128(a, b); }
+    static I INot(I value) { return _mm_xor_si128(value, _mm_set1_epi32(-1)); }
+    static I ICmpLt(I a, I b) { return _mm_cmplt_epi32(a, b); }
+    static I ICmpEq(I a, I b) { return _mm_cmpeq_epi32(a, b); }
+    template <int Bits>
+    static I ShiftRight(I value) { return _mm_srli_epi32(value, Bits); }
+    template <int Bits>
+    static I ShiftLeft(I value) { return _mm_slli_epi32(value, Bits); }
+};
+
+} // namespace
+
+namespace NoiseKernels {
+
+std::size_t AccumulateSimplex2Sse41(const float* x, const float* y, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude) {
+    return AccumulateSimplex2<Sse41Ops>(x, y, out, count, seed, amplitude);
+}
+
+std::size_t AccumulateSimplex3Sse41(const float* x, const float* y, const float* z, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude) {
+    return AccumulateSimplex3<Sse41Ops>(x, y, z, out, count, seed, amplitude);
+}
+
+} // namespace NoiseKernels
+
+} // namespace BoxelGame
+
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "world/PaddedChunk.hpp"
+#include "core/Profiler.hpp"
+
+namespace BoxelGame {
+
+void PaddedChunk::Build(const ChunkNeighborhood& neighborhood) {
+    BOXEL_PROFILE_SCOPE("PaddedChunk::Build");
+    
+    // 中心チャンクは展開してから行単位でコピー
+    std::array<BlockId, kChunkVolume> center{};
+    if (const Chunk* chunk = neighborhood.GetCenter()) {
+        chunk->Unpack(center);
+    }
+    for (int y = 0; y < kChunkSize; ++y) {
+        for (int z = 0; z < kChunkSize; ++z) {
+            const BlockId* row = &center[ToChunkIndex(0, y, z)];
+            BlockId* out = &blocks[Index(1, y + 1, z + 1)];
+            for (int x = 0; x < kChunkSize; ++x) {
+                out[x] = row[x];
+            }
+        }
+    }
+    
+    // 境界の殻（6面・12辺・8頂点）は近傍から1ブロックずつ取得
+    for (int y = -1; y <= kChunkSize; ++y) {
+        const bool yBorder = y < 0 || y == kChunkSize;
+        for (int z = -1; z <= kChunkSize; ++z) {
+            const bool zBorder = z < 0 || z == kChunkSize;
+            if (yBorder || zBorder) {
+                for (int x = -1; x <= kChunkSize; ++x) {
+                    Set(x, y, z, neighborhood.GetBlock(x, y, z));
+                }
+            } else {
+                Set(-1, y, z, neighborhood.GetBlock(-1, y, z));
+                Set(kChunkSize, y, z, neighborhood.GetBlock(kChunkSize, y, z));
+            }
+        }
+    }
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+// シンプレックスノイズの演算本体（Noise.cpp・NoiseSse41.cpp・NoiseAvx2.cpp専用の内部ヘッダー）
+// 演算はOps（スカラー・SSE4.1・AVX2）の同名関数で記述し、どの実装でも同じ順序で同じ演算を行う
+// これにより実装間の結果がビット単位で一致する（縮約されたFMAを使わない限り）
+// 命令セットを指定してコンパイルするファイルから取り込むため、標準ライブラリの関数・テンプレートは使わない
+#include <cstddef>
+#include <cstdint>
+
+namespace BoxelGame {
+namespace {
+
+namespace SimplexConstants {
+constexpr float kSkew2 = 0.36602540378f;     // (√3 - 1) / 2
+constexpr float kUnskew2 = 0.21132486540f;   // (3 - √3) / 6
+constexpr float kSkew3 = 1.0f / 3.0f;
+constexpr float kUnskew3 = 1.0f / 6.0f;
+constexpr float kScale2 = 40.0f;             // 出力をおおよそ[-1, 1]へ
+constexpr float kScale3 = 32.0f;
+constexpr std::int32_t kPrimeX = 501125321;
+constexpr std::int32_t kPrimeY = 1136930381;
+constexpr std::int32_t kPrimeZ = 1720413743;
+constexpr std::int32_t kHashMultiplier = 0x27d4eb2d;
+}
+
+// 格子点のハッシュ（下位4ビットで勾配を選ぶ）
+template <typename Ops>
+typename Ops::I HashLattice(typename Ops::I seed, typename Ops::I i, typename Ops::I j, typename Ops::I k) {
+    using namespace SimplexConstants;
+    typename Ops::I hash = Ops::IXor(seed, Ops::IMul(i, Ops::SetI(kPrimeX)));
+    hash = Ops::IXor(hash, Ops::IMul(j, Ops::SetI(kPrimeY)));
+    hash = Ops::IXor(hash, Ops::IMul(k, Ops::SetI(kPrimeZ)));
+    hash = Ops::IMul(hash, Ops::SetI(kHashMultiplier));
+    return Ops::IXor(hash, Ops::template ShiftRight<15>(hash));
+}
+
+// 2D勾配（8方向）との内積
+template <typename Ops>
+typename Ops::F Gradient2(typename Ops::I hash, typename Ops::F x, typename Ops::F y) {
+    const typename Ops::I low = Ops::ICmpLt(Ops::IAnd(hash, Ops::SetI(7)), Ops::SetI(4));
+    const typename Ops::F u = Ops::Select(low, x, y);
+    const typename Ops::F v = Ops::Select(low, y, x);
+    const typename Ops::F signedU = Ops::FlipSign(u, Ops::template ShiftLeft<31>(hash));
+    const typename Ops::F signedV = Ops::FlipSign(Ops::Add(v, v), Ops::template ShiftLeft<30>(hash));
+    return Ops::Add(signedU, signedV);
+}
+
+// 3D勾配（立方体の12辺方向、16通りのうち4つは重複）との内積
+template <typename Ops>
+typename Ops::F Gradient3(typename Ops::I hash, typename Ops::F x, typename Ops::F y, typename Ops::F z) {
+    const typename Ops::I h = Ops::IAnd(hash, Ops::SetI(15));
+    const typename Ops::F u = Ops::Select(Ops::ICmpLt(h, Ops::SetI(8)), x, y);
+    const typename Ops::I useX = Ops::IOr(Ops::ICmpEq(h, Ops::SetI(12)), Ops::ICmpEq(h, Ops::SetI(14)));
+    const typename Ops::F v = Ops::Select(Ops::ICmpLt(h, Ops::SetI(4)), y, Ops::Select(useX, x, z));
+    const typename Ops::F signedU = Ops::FlipSign(u, Ops::template ShiftLeft<31>(h));
+    const typename Ops::F signedV = Ops::FlipSign(v, Ops::template ShiftLeft<30>(h));
+    return Ops::Add(signedU, signedV);
+}
+
+// 頂点の寄与 (max(r² - d², 0))⁴ × 勾配内積
+template <typename Ops>
+typename Ops::F Falloff(typename Ops::F t, typename Ops::F gradient) {
+    t = Ops::Max(t, Ops::SetF(0.0f));
+    t = Ops::Mul(t, t);
+    return Ops::Mul(Ops::Mul(t, t), gradient);
+}
+
+template <typename Ops>
+typename Ops::F Simplex2(typename Ops::F x, typename Ops::F y, typename Ops::I seed) {
+    using namespace SimplexConstants;
+    using F = typename Ops::F;
+    using I = typename Ops::I;
+    
+    const F skew = Ops::Mul(Ops::Add(x, y), Ops::SetF(kSkew2));
+    const F fi = Ops::Floor(Ops::Add(x, skew));
+    const F fj = Ops::Floor(Ops::Add(y, skew));
+    const F unskew = Ops::Mul(Ops::Add(fi, fj), Ops::SetF(kUnskew2));
+    const F x0 = Ops::Sub(x, Ops::Sub(fi, unskew));
+    const F y0 = Ops::Sub(y, Ops::Sub(fj, unskew));
+    const I i = Ops::ToInt(fi);
+    const I j = Ops::ToInt(fj);
+    
+    // 2番目の頂点は x0 >= y0 なら (1, 0)、それ以外は (0, 1)
+    const I xFirst = Ops::CmpGe(x0, y0);
+    const F x1 = Ops::Add(Ops::Sub(x0, Ops::MaskF(xFirst, Ops::SetF(1.0f))), Ops::SetF(kUnskew2));
+    const F y1 = Ops::Add(Ops::Sub(y0, Ops::MaskF(Ops::INot(xFirst), Ops::SetF(1.0f))), Ops::SetF(kUnskew2));
+    const F x2 = Ops::Add(Ops::Sub(x0, Ops::SetF(1.0f)), Ops::SetF(2.0f * kUnskew2));
+    const F y2 = Ops::Add(Ops::Sub(y0, Ops::SetF(1.0f)), Ops::SetF(2.0f * kUnskew2));
+    
+    // マスクは全ビット1（-1）のため、減算で+1になる
+    const I zero = Ops::SetI(0);
+    const I h0 = HashLattice<Ops>(seed, i, j, zero);
+    const I h1 = HashLattice<Ops>(seed, Ops::ISub(i, xFirst), Ops::ISub(j, Ops::INot(xFirst)), zero);
+    const I h2 = HashLattice<Ops>(seed, Ops::IAdd(i, Ops::SetI(1)), Ops::IAdd(j, Ops::SetI(1)), zero);
+    
+    const F half = Ops::SetF(0.5f);
+    const F n0 = Falloff<Ops>(Ops::Sub(Ops::Sub(half, Ops::Mul(x0, x0)), Ops::Mul(y0, y0)), Gradient2<Ops>(h0, x0, y0));
+    const F n1 = Falloff<Ops>(Ops::Sub(Ops::Sub(half, Ops::Mul(x1, x1)), Ops::Mul(y1, y1)), Gradient2<Ops>(h1, x1, y1));
+    const F n2 = Falloff<Ops>(Ops::Sub(Ops::Sub(half, Ops::Mul(x2, x2)), Ops::Mul(y2, y2)), Gradient2<Ops>(h2, x2, y2));
+    return Ops::Mul(Ops::Add(Ops::Add(n0, n1), n2), Ops::SetF(kScale2));
+}
+
+template <typename Ops>
+typename Ops::F Simplex3(typename Ops::F x, typename Ops::F y, typename Ops::F z, typename Ops::I seed) {
+    using namespace SimplexConstants;
+    using F = typename Ops::F;
+    using I = typename Ops::I;
+    
+    const F skew = Ops::Mul(Ops::Add(Ops::Add(x, y), z), Ops::SetF(kSkew3));
+    const F fi = Ops::Floor(Ops::Add(x, skew));
+    const F fj = Ops::Floor(Ops::Add(y, skew));
+    const F fk = Ops::Floor(Ops::Add(z, skew));
+    const F unskew = Ops::Mul(Ops::Add(Ops::Add(fi, fj), fk), Ops::SetF(kUnskew3));
+    const F x0 = Ops::Sub(x, Ops::Sub(fi, unskew));
+    const F y0 = Ops::Sub(y, Ops::Sub(fj, unskew));
+    const F z0 = Ops::Sub(z, Ops::Sub(fk, unskew));
+    const I i = Ops::ToInt(fi);
+    const I j = Ops::ToInt(fj);
+    const I k = Ops::ToInt(fk);
+    
+    // 単体内の順位から2・3番目の頂点を分岐なしで求める
+    const I xy = Ops::CmpGe(x0, y0);
+    const I yz = Ops::CmpGe(y0, z0);
+    const I xz = Ops::CmpGe(x0, z0);
+    const I i1 = Ops::IAnd(xy, xz);
+    const I j1 = Ops::IAnd(Ops::INot(xy), yz);
+    const I k1 = Ops::IAnd(Ops::INot(xz), Ops::INot(yz));
+    const I i2 = Ops::IOr(xy, xz);
+    const I j2 = Ops::IOr(Ops::INot(xy), yz);
+    const I k2 = Ops::INot(Ops::IAnd(xz, yz));
+    
+    const F one = Ops::SetF(1.0f);
+    const F g1 = Ops::SetF(kUnskew3);
+    const F g2 = Ops::SetF(2.0f * kUnskew3);
+    const F g3 = Ops::SetF(3.0f * kUnskew3);
+    const F x1 = Ops::Add(Ops::Sub(x0, Ops::MaskF(i1, one)), g1);
+    const F y1 = Ops::Add(Ops::Sub(y0, Ops::MaskF(j1, one)), g1);
+    const F z1 = Ops::Add(Ops::Sub(z0, Ops::MaskF(k1, one)), g1);
+    const F x2 = Ops::Add(Ops::Sub(x0, Ops::MaskF(i2, one)), g2);
+    const F y2 = Ops::Add(Ops::Sub(y0, Ops::MaskF(j2, one)), g2);
+    const F z2 = Ops::Add(Ops::Sub(z0, Ops::MaskF(k2, one)), g2);
+    const F x3 = Ops::Add(Ops::Sub(x0, one), g3);
+    const F y3 = Ops::Add(Ops::Sub(y0, one), g3);
+    const F z3 = Ops::Add(Ops::Sub(z0, one), g3);
+    
+    const I iOne = Ops::SetI(1);
+    const I h0 = HashLattice<Ops>(seed, i, j, k);
+    const I h1 = HashLattice<Ops>(seed, Ops::ISub(i, i1), Ops::ISub(j, j1), Ops::ISub(k, k1));
+    const I h2 = HashLattice<Ops>(seed, Ops::ISub(i, i2), Ops::ISub(j, j2), Ops::ISub(k, k2));
+    const I h3 = HashLattice<Ops>(seed, Ops::IAdd(i, iOne), Ops::IAdd(j, iOne), Ops::IAdd(k, iOne));
+    
+    const F radius = Ops::SetF(0.6f);
+    const auto contribution = [&radius](I hash, F px, F py, F pz) {
+        const F t = Ops::Sub(Ops::Sub(Ops::Sub(radius, Ops::Mul(px, px)), Ops::Mul(py, py)), Ops::Mul(pz, pz));
+        return Falloff<Ops>(t, Gradient3<Ops>(hash, px, py, pz));
+    };
+    const F n0 = contribution(h0, x0, y0, z0);
+    const F n1 = contribution(h1, x1, y1, z1);
+    const F n2 = contribution(h2, x2, y2, z2);
+    const F n3 = contribution(h3, x3, y3, z3);
+    return Ops::Mul(Ops::Add(Ops::Add(Ops::Add(n0, n1), n2), n3), Ops::SetF(kScale3));
+}
+
+// out[i] += amplitude × noise(x[i], y[i]) を幅Ops::kWidthごとに処理し、処理した個数を返す（端数は呼び出し側）
+template <typename Ops>
+std::size_t AccumulateSimplex2(const float* x, const float* y, float* out, std::size_t count,
+                               std::uint32_t seed, float amplitude) {
+    const typename Ops::I seedVector = Ops::SetI(static_cast<std::int32_t>(seed));
+    const typename Ops::F amplitudeVector = Ops::SetF(amplitude);
+    std::size_t i = 0;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const typename Ops::F noise = Simplex2<Ops>(Ops::Load(x + i), Ops::Load(y + i), seedVector);
+        Ops::Store(out + i, Ops::Add(Ops::Load(out + i), Ops::Mul(noise, amplitudeVector)));
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t AccumulateSimplex3(const float* x, const float* y, const float* z, float* out, std::size_t count,
+                               std::uint32_t seed, float amplitude) {
+    const typename Ops::I seedVector = Ops::SetI(static_cast<std::int32_t>(seed));
+    const typename Ops::F amplitudeVector = Ops::SetF(amplitude);
+    std::size_t i = 0;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const typename Ops::F noise = Simplex3<Ops>(Ops::Load(x + i), Ops::Load(y + i), Ops::Load(z + i), seedVector);
+        Ops::Store(out + i, Ops::Add(Ops::Load(out + i), Ops::Mul(noise, amplitudeVector)));
+    }
+    return i;
+}
+
+} // namespace
+
+// 命令セット別のファイルで実装するまとめ評価（x86向けビルドのみ、処理した個数を返す）
+namespace NoiseKernels {
+std::size_t AccumulateSimplex2Sse41(const float* x, const float* y, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude);
+std::size_t AccumulateSimplex3Sse41(const float* x, const float* y, const float* z, float* out, std::size_t count,
+                                    std::uint32_t seed, float amplitude);
+std::size_t AccumulateSimplex2Avx2(const float* x, const float* y, float* out, std::size_t count,
+                                   std::uint32_t seed, float amplitude);
+std::size_t AccumulateSimplex3Avx2(const float* x, const float* y, const float* z, float* out, std::size_t count,
+                                   std::uint32_t seed, float amplitude);
+} // namespace NoiseKernels
+
+} // namespace BoxelGame
\ No newline at end of file
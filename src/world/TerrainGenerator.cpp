@@ -0,0 +1,258 @@
+#include "world/TerrainGenerator.hpp"
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace BoxelGame {
+
+namespace {
+
+// 地表判定のため、チャンクの1つ上の層まで密度を求める
+constexpr int kDensityLayers = kChunkSize + 1;
+constexpr int kColumnCount = kChunkSize * kChunkSize;
+// fBm（振幅の総和で正規化したシンプレックスノイズ）の絶対値の上限に余裕を持たせた値
+constexpr float kDensityNoiseBound = 1.1f;
+
+std::uint64_t PackColumn(int chunkX, int chunkZ) {
+    return PackChunkCoord({chunkX, 0, chunkZ});
+}
+
+// ワールドのシードと用途番号からノイズのシードを導く（splitmix32系の混合）
+std::uint32_t DeriveSeed(std::uint32_t seed, std::uint32_t stream) {
+    std::uint32_t value = seed + stream * 0x9e3779b9u;
+    value = (value ^ (value >> 16)) * 0x85ebca6bu;
+    value = (value ^ (value >> 13)) * 0xc2b2ae35u;
+    return value ^ (value >> 16);
+}
+
+// 生成1回分の作業領域（ワーカーごとに使い回す）
+struct GenerationScratch {
+    ColumnHeightmap column;  // キャッシュに無い列の高さマップ
+    std::array<float, kColumnCount * kDensityLayers> density;
+    std::array<BlockId, kChunkVolume> blocks;
+};
+
+GenerationScratch& GetGenerationScratch() {
+    thread_local GenerationScratch scratch;
+    return scratch;
+}
+
+} // namespace
+
+TerrainGenerator::TerrainGenerator()
+    : TerrainGenerator(TerrainSettings{}) {
+}
+
+TerrainGenerator::TerrainGenerator(const TerrainSettings& settings)
+    : m_settings(settings)
+    , m_surface_noise(settings.surface)
+    , m_density_noise(settings.density) {
+    m_surface_noise.seed = DeriveSeed(settings.seed, 1);
+    m_density_noise.seed = DeriveSeed(settings.seed, 2);
+    // 丸め誤差を見込んで1ブロック分広げる
+    m_density_margin = std::abs(settings.densityAmplitude) * kDensityNoiseBound + 1.0f;
+}
+
+void TerrainGenerator::GenerateChunk(const ChunkCoord& coord, Chunk& out) const {
+    const ColumnHeightmap* column = FindColumn(coord.x, coord.z);
+    if (column == nullptr) {
+        ColumnHeightmap& scratchColumn = GetGenerationScratch().column;
+        ComputeColumn(coord.x, coord.z, scratchColumn);
+        column = &scratchColumn;
+    }
+    GenerateChunk(coord, *column, out);
+}
+
+void TerrainGenerator::GenerateChunk(const ChunkCoord& coord, const ColumnHeightmap& column, Chunk& out) const {
+    BOXEL_PROFILE_SCOPE("TerrainGenerator::GenerateChunk");
+    
+    if (m_settings.skipUniformChunks) {
+        switch (ClassifyChunk(coord, column)) {
+        case TerrainChunkClass::Air:
+            out.Fill(Blocks::Air);
+            m_air_chunks.fetch_add(1, std::memory_order_relaxed);
+            return;
+        case TerrainChunkClass::Solid:
+            out.Fill(Blocks::Stone);
+            m_solid_chunks.fetch_add(1, std::memory_order_relaxed);
+            return;
+        case TerrainChunkClass::Mixed:
+            break;
+        }
+    }
+    m_noise_chunks.fetch_add(1, std::memory_order_relaxed);
+    
+    GenerationScratch& scratch = GetGenerationScratch();
+    const int originX = coord.x * kChunkSize;
+    const int originY = coord.y * kChunkSize;
+    const int originZ = coord.z * kChunkSize;
+    FractalNoise3DGrid(m_density_noise, originX, originY, originZ, kChunkSize, kDensityLayers, kChunkSize,
+                       scratch.density);
+    
+    // 密度 = (地表の高さ - y) + 3Dノイズ。正なら地中
+    const auto isSolid = [&](int columnIndex, int y) {
+        const float height = column.heights[columnIndex];
+        const float density = height - static_cast<float>(originY + y) +
+                              m_settings.densityAmplitude * scratch.density[columnIndex + y * kColumnCount];
+        return density > 0.0f;
+    };
+    
+    for (int columnIndex = 0; columnIndex < kColumnCount; ++columnIndex) {
+        const float height = column.heights[columnIndex];
+        bool solidAbove = isSolid(columnIndex, kChunkSize);
+        for (int y = kChunkSize - 1; y >= 0; --y) {
+            const bool solid = isSolid(columnIndex, y);
+            BlockId block = Blocks::Air;
+            if (solid && !solidAbove) {
+                block = Blocks::Grass;
+            } else if (solid) {
+                // 地表付近は土、それより深い所は石
+                block = static_cast<float>(originY + y) >= height - static_cast<float>(m_settings.dirtDepth)
+                    ? Blocks::Dirt : Blocks::Stone;
+            }
+            scratch.blocks[columnIndex + y * kColumnCount] = block;
+            solidAbove = solid;
+        }
+    }
+    out.Assign(scratch.blocks);
+}
+
+std::unique_ptr<Chunk> TerrainGenerator::GenerateChunk(const ChunkCoord& coord) const {
+    auto chunk = std::make_unique<Chunk>();
+    GenerateChunk(coord, *chunk);
+    return chunk;
+}
+
+std::vector<std::unique_ptr<Chunk>> TerrainGenerator::GenerateChunks(JobSystem& jobs,
+                                                                     std::span<const ChunkCoord> coords) {
+    BOXEL_PROFILE_SCOPE("TerrainGenerator::GenerateChunks");
+    
+    PrepareColumns(jobs, coords);
+    
+    // 各ジョブは自分の要素にのみ書き込むため、結果は実行順・スレッド数に依存しない
+    std::vector<std::unique_ptr<Chunk>> chunks(coords.size());
+    jobs.ParallelFor(coords.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            chunks[i] = GenerateChunk(coords[i]);
+        }
+    });
+    return chunks;
+}
+
+void TerrainGenerator::GenerateInto(JobSystem& jobs, std::span<const ChunkCoord> coords, ChunkManager& chunks) {
+    std::vector<std::unique_ptr<Chunk>> generated = GenerateChunks(jobs, coords);
+    for (std::size_t i = 0; i < coords.size(); ++i) {
+        chunks.Insert(coords[i], std::move(generated[i]));
+    }
+}
+
+void TerrainGenerator::ComputeColumn(int chunkX, int chunkZ, ColumnHeightmap& out) const {
+    FractalNoise2DGrid(m_surface_noise, chunkX * kChunkSize, chunkZ * kChunkSize, kChunkSize, kChunkSize, out.heights);
+    for (float& height : out.heights) {
+        height = m_settings.baseHeight + m_settings.heightAmplitude * height;
+    }
+    const auto [minIt, maxIt] = std::minmax_element(out.heights.begin(), out.heights.end());
+    out.minHeight = *minIt;
+    out.maxHeight = *maxIt;
+}
+
+void TerrainGenerator::PrepareColumns(JobSystem& jobs, std::span<const ChunkCoord> coords) {
+    BOXEL_PROFILE_SCOPE("TerrainGenerator::PrepareColumns");
+    
+    // キャッシュへの追加はメインスレッドで行い、ジョブはそれぞれの高さマップにのみ書き込む
+    struct ColumnTask {
+        int chunkX;
+        int chunkZ;
+        ColumnHeightmap* column;
+    };
+    std::vector<ColumnTask> tasks;
+    for (const ChunkCoord& coord : coords) {
+        std::unique_ptr<ColumnHeightmap>& column = m_columns[PackColumn(coord.x, coord.z)];
+        if (!column) {
+            column = std::make_unique<ColumnHeightmap>();
+            tasks.push_back({coord.x, coord.z, column.get()});
+        }
+    }
+    jobs.ParallelFor(tasks.size(), 4, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ComputeColumn(tasks[i].chunkX, tasks[i].chunkZ, *tasks[i].column);
+        }
+    });
+}
+
+const ColumnHeightmap& TerrainGenerator::GetColumn(int chunkX, int chunkZ) {
+    std::unique_ptr<ColumnHeightmap>& column = m_columns[PackColumn(chunkX, chunkZ)];
+    if (!column) {
+        column = std::make_unique<ColumnHeightmap>();
+        ComputeColumn(chunkX, chunkZ, *column);
+    }
+    return *column;
+}
+
+const ColumnHeightmap* TerrainGenerator::FindColumn(int chunkX, int chunkZ) const {
+    const auto it = m_columns.find(PackColumn(chunkX, chunkZ));
+    return it != m_columns.end() ? it->second.get() : nullptr;
+}
+
+void TerrainGenerator::EvictColumn(int chunkX, int chunkZ) {
+    m_columns.erase(PackColumn(chunkX, chunkZ));
+}
+
+TerrainChunkClass TerrainGenerator::ClassifyChunk(const ChunkCoord& coord, const ColumnHeightmap& column) const {
+    const float bottom = static_cast<float>(coord.y * kChunkSize);
+    // 密度の最大値が0以下なら全て空気
+    if (bottom >= column.maxHeight + m_density_margin) {
+        return TerrainChunkClass::Air;
+    }
+    // 1つ上の層まで密度の最小値が正（草にならない）で、土の層より深ければ全て石
+    const float top = bottom + static_cast<float>(kChunkSize - 1);
+    if (top + 1.0f <= column.minHeight - m_density_margin &&
+        top < column.minHeight - static_cast<float>(m_settings.dirtDepth)) {
+        return TerrainChunkClass::Solid;
+    }
+    return TerrainChunkClass::Mixed;
+}
+
+int TerrainGenerator::GetMaxSolidY(const ColumnHeightmap& column) const {
+    return static_cast<int>(std::ceil(column.maxHeight + m_density_margin));
+}
+
+float TerrainGenerator::GetSurfaceHeight(int x, int z) const {
+    const int chunkX = x >> kChunkSizeLog2;
+    const int chunkZ = z >> kChunkSizeLog2;
+    if (const ColumnHeightmap* column = FindColumn(chunkX, chunkZ)) {
+        return column->GetHeight(x - chunkX * kChunkSize, z - chunkZ * kChunkSize);
+    }
+    float noise = 0.0f;
+    FractalNoise2DGrid(m_surface_noise, x, z, 1, 1, std::span<float>(&noise, 1));
+    return m_settings.baseHeight + m_settings.heightAmplitude * noise;
+}
+
+int TerrainGenerator::FindTopSolidY(int x, int z) const {
+    // 地表の高さ ± 密度の振れ幅の範囲を上から調べる（範囲の下端より下は必ず地中）
+    const float height = GetSurfaceHeight(x, z);
+    const int lowest = static_cast<int>(std::floor(height - m_density_margin));
+    for (int y = static_cast<int>(std::ceil(height + m_density_margin)); y > lowest; --y) {
+        if (IsSolidAt(height, x, y, z)) {
+            return y;
+        }
+    }
+    return lowest;
+}
+
+bool TerrainGenerator::IsSolidAt(float height, int x, int y, int z) const {
+    float noise = 0.0f;
+    FractalNoise3DGrid(m_density_noise, x, y, z, 1, 1, 1, std::span<float>(&noise, 1));
+    return height - static_cast<float>(y) + m_settings.densityAmplitude * noise > 0.0f;
+}
+
+TerrainGenerator::Stats TerrainGenerator::GetStats() const {
+    Stats stats;
+    stats.airChunks = m_air_chunks.load(std::memory_order_relaxed);
+    stats.solidChunks = m_solid_chunks.load(std::memory_order_relaxed);
+    stats.noiseChunks = m_noise_chunks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "world/VoxelRaycast.hpp"
+#include "core/Exception.hpp"
+#include "core/Profiler.hpp"
+#include "world/BlockRegistry.hpp"
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace BoxelGame {
+
+namespace {
+
+// ジョブ1件で調べるレイの数（1本は数十〜数百ステップのため細かく分ける）
+constexpr std::size_t kRaysPerJob = 16;
+
+bool StopsRay(BlockId block, RaycastFilter filter) {
+    return filter == RaycastFilter::Opaque ? IsOpaqueBlock(block) : block != Blocks::Air;
+}
+
+// 未ロード・空気のみのチャンクは中身を読まずに通過する
+bool IsSkippableChunk(const Chunk* chunk) {
+    return chunk == nullptr || chunk->IsEmpty();
+}
+
+void ValidateRay(const VoxelRay& ray) {
+    // 無限遠まで調べると未ロード領域を際限なく進むため、有限の最大距離を要求する
+    if (!std::isfinite(ray.maxDistance)) {
+        throw BoxelGameException("レイの最大距離は有限である必要があります: " + std::to_string(ray.maxDistance));
+    }
+}
+
+} // namespace
+
+VoxelRaycastHit RaycastVoxels(const ChunkManager& chunks, const VoxelRay& ray) {
+    ValidateRay(ray);
+    
+    const float length = std::sqrt(ray.direction[0] * ray.direction[0] + ray.direction[1] * ray.direction[1] +
+                                   ray.direction[2] * ray.direction[2]);
+    if (!(length > 0.0f) || ray.maxDistance < 0.0f) {
+        return {};
+    }
+    
+    // cell: 現在のブロック、tMax: 各軸の次の境界までの距離、tDelta: 各軸で1ブロック進む距離
+    constexpr float kInfinity = std::numeric_limits<float>::infinity();
+    int cell[3];
+    int step[3];
+    float tMax[3];
+    float tDelta[3];
+    int dominantAxis = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const float origin = ray.origin[axis];
+        const float direction = ray.direction[axis] / length;
+        cell[axis] = static_cast<int>(std::floor(origin));
+        if (direction > 0.0f) {
+            step[axis] = 1;
+            tDelta[axis] = 1.0f / direction;
+            tMax[axis] = (static_cast<float>(cell[axis] + 1) - origin) * tDelta[axis];
+        } else if (direction < 0.0f) {
+            step[axis] = -1;
+            tDelta[axis] = -1.0f / direction;
+            tMax[axis] = (origin - static_cast<float>(cell[axis])) * tDelta[axis];
+        } else {
+            step[axis] = 0;
+            tDelta[axis] = kInfinity;
+            tMax[axis] = kInfinity;
+        }
+        if (std::abs(ray.direction[axis]) > std::abs(ray.direction[dominantAxis])) {
+            dominantAxis = axis;
+        }
+    }
+    
+    int chunkPosition[3] = {BlockToChunk(cell[0]), BlockToChunk(cell[1]), BlockToChunk(cell[2])};
+    const Chunk* chunk = chunks.Find({chunkPosition[0], chunkPosition[1], chunkPosition[2]});
+    bool skipChunk = IsSkippableChunk(chunk);
+    
+    BlockFace face = MakeBlockFace(dominantAxis, step[dominantAxis] < 0);
+    float distance = 0.0f;
+    while (true) {
+        if (!skipChunk) {
+            const BlockId block = chunk->Get(BlockToLocal(cell[0]), BlockToLocal(cell[1]), BlockToLocal(cell[2]));
+            if (StopsRay(block, ray.filter)) {
+                VoxelRaycastHit hit;
+                hit.hit = true;
+                hit.block[0] = cell[0];
+                hit.block[1] = cell[1];
+                hit.block[2] = cell[2];
+                hit.blockId = block;
+                hit.face = face;
+                hit.distance = distance;
+                return hit;
+            }
+        }
+        
+        // 最も近い境界を越えて隣のブロックへ進む
+        int axis = tMax[0] < tMax[1] ? 0 : 1;
+        if (tMax[2] < tMax[axis]) {
+            axis = 2;
+        }
+        distance = tMax[axis];
+        if (distance > ray.maxDistance) {
+            return {};
+        }
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+        face = MakeBlockFace(axis, step[axis] < 0);
+        
+        // チャンク境界をまたいだ時のみ検索する
+        const int nextChunk = BlockToChunk(cell[axis]);
+        if (nextChunk != chunkPosition[axis]) {
+            chunkPosition[axis] = nextChunk;
+            chunk = chunks.Find({chunkPosition[0], chunkPosition[1], chunkPosition[2]});
+            skipChunk = IsSkippableChunk(chunk);
+        }
+    }
+}
+
+void RaycastVoxels(JobSystem& jobs, const ChunkManager& chunks, std::span<const VoxelRay> rays,
+                   std::span<VoxelRaycastHit> out) {
+    BOXEL_PROFILE_SCOPE("RaycastVoxels");
+    
+    if (out.size() != rays.size()) {
+        throw BoxelGameException("レイと結果の数が一致しません");
+    }
+    // ジョブ内で例外を投げないよう、投入前に検証する
+    for (const VoxelRay& ray : rays) {
+        ValidateRay(ray);
+    }
+    
+    // 各ジョブは自分の範囲の結果にのみ書き込む
+    jobs.ParallelFor(rays.size(), kRaysPerJob, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = RaycastVoxels(chunks, rays[i]);
+        }
+    });
+}
+
+} // namespace BoxelGame
\ No newline at end of file
@@ -19,6 +19,12 @@ public:
     int GetWidth() const override { return m_width; }
     int GetHeight() const override { return m_height; }
     const std::string& GetTitle() const override { return m_title; }
+    bool HasGraphicsContext() const override { return false; }
+    void MakeContextCurrent() override {}
+    void DetachContext() override {}
+    void SetPresentMode(PresentMode mode) override { m_present_mode = mode; }
+    PresentMode GetPresentMode() const override { return m_present_mode; }
+    InputEventQueue& GetInputEvents() override { return m_input_events; }
     
     // テスト用メソッド
     void SetShouldClose(bool should_close) { m_should_close = should_close; }
@@ -26,6 +32,7 @@ public:
         m_framebuffer_width = width; 
         m_framebuffer_height = height; 
     }
+    bool PushInputEvent(const InputEvent& event) { return m_input_events.TryPush(event); }
     
     // 統計情報（テスト検証用）
     int GetSwapBuffersCallCount() const { return m_swap_buffers_calls; }
@@ -37,6 +44,8 @@ private:
     std::string m_title;
     
     bool m_should_close = false;
+    PresentMode m_present_mode = PresentMode::VSync;
+    InputEventQueue m_input_events;
     int m_framebuffer_width;
     int m_framebuffer_height;
     
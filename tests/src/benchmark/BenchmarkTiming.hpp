@@ -0,0 +1,30 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string_view>
+
+namespace BoxelGame {
+namespace Test {
+
+// ベンチマークは実行時間が環境に左右され、単体テストの実行を遅くするため、
+// 環境変数 BOXEL_RUN_BENCHMARKS=1 の場合のみ実行する（それ以外は何もせずに成功する）
+inline bool ShouldRunBenchmarks() {
+    const char* value = std::getenv("BOXEL_RUN_BENCHMARKS");
+    return value != nullptr && std::string_view(value) == "1";
+}
+
+// work() を repeat 回実行し、1回あたり itemsPerRun 件を処理したとして毎秒の件数を返す
+template <typename Function>
+double MeasureItemsPerSecond(double itemsPerRun, int repeat, Function&& work) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) {
+        work();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return itemsPerRun * repeat / std::max(seconds, 1e-9);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <doctest/doctest.h>
+#include "BenchmarkTiming.hpp"
+#include "render/GreedyMesher.hpp"
+#include "world/PaddedChunk.hpp"
+#include <spdlog/spdlog.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 起伏のある地表・洞窟・複数種別を含む決定的なテスト用チャンク
+std::vector<PaddedChunk> MakeTerrainChunks(int count) {
+    std::vector<PaddedChunk> chunks(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        PaddedChunk& chunk = chunks[static_cast<std::size_t>(i)];
+        for (int y = -1; y <= kChunkSize; ++y) {
+            for (int z = -1; z <= kChunkSize; ++z) {
+                for (int x = -1; x <= kChunkSize; ++x) {
+                    const double wx = x + i * 16.0;
+                    const double surface = 8.0 + 4.0 * std::sin(wx * 0.21) + 3.0 * std::cos(z * 0.17 + i);
+                    const std::uint32_t hash = static_cast<std::uint32_t>((x + 1) * 73856093) ^
+                                               static_cast<std::uint32_t>((y + 1) * 19349663) ^
+                                               static_cast<std::uint32_t>((z + 1 + i) * 83492791);
+                    BlockId block = Blocks::Air;
+                    if (y < surface - 3.0) {
+                        block = hash % 17 == 0 ? Blocks::Air : Blocks::Stone;
+                    } else if (y < surface - 1.0) {
+                        block = Blocks::Dirt;
+                    } else if (y < surface) {
+                        block = Blocks::Grass;
+                    }
+                    chunk.Set(x, y, z, block);
+                }
+            }
+        }
+    }
+    return chunks;
+}
+
+} // namespace
+
+TEST_CASE("ベンチマーク: チャンクメッシュ生成スループット") {
+    if (!ShouldRunBenchmarks()) {
+        return;
+    }
+    
+    const std::vector<PaddedChunk> chunks = MakeTerrainChunks(32);
+    constexpr int kIterations = 4;
+    
+    GreedyMesher mesher;
+    ChunkMesh mesh;
+    ChunkMesh reference;
+    std::size_t quadCount = 0;
+    std::size_t faceCount = 0;
+    for (const PaddedChunk& chunk : chunks) {
+        mesher.Mesh(chunk, mesh);
+        NaiveMesher::Mesh(chunk, reference);
+        REQUIRE(mesh.vertices == reference.vertices);
+        quadCount += mesh.GetQuadCount();
+        faceCount += mesh.CountFaces();
+    }
+    
+    const auto chunkCount = static_cast<double>(chunks.size());
+    const double greedyRate = MeasureItemsPerSecond(chunkCount, kIterations, [&] {
+        for (const PaddedChunk& chunk : chunks) {
+            mesher.Mesh(chunk, mesh);
+        }
+    });
+    const double naiveRate = MeasureItemsPerSecond(chunkCount, kIterations, [&] {
+        for (const PaddedChunk& chunk : chunks) {
+            NaiveMesher::Mesh(chunk, reference);
+        }
+    });
+    
+    spdlog::info("メッシュ生成: ビットマスクGreedy {:.0f} chunks/s / 参照実装 {:.0f} chunks/s ({:.1f}倍)",
+                 greedyRate, naiveRate, greedyRate / naiveRate);
+    spdlog::info("  {}チャンク: 面 {} → 四角形 {} (統合率 {:.1f}%)", chunks.size(), faceCount, quadCount,
+                 100.0 * (1.0 - static_cast<double>(quadCount) / static_cast<double>(faceCount)));
+    CHECK(greedyRate > 0.0);
+    CHECK(quadCount < faceCount);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <doctest/doctest.h>
+#include "BenchmarkTiming.hpp"
+#include "world/Noise.hpp"
+#include <spdlog/spdlog.h>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 1チャンク分（16³）の格子を繰り返し評価した毎秒のサンプル数
+double MeasureSamplesPerSecond(NoiseBackend backend, const std::vector<float>& x, const std::vector<float>& y,
+                               const std::vector<float>& z, std::vector<float>& out, int iterations) {
+    std::uint32_t seed = 0;
+    return MeasureItemsPerSecond(static_cast<double>(out.size()), iterations, [&] {
+        SimplexNoise3D(x, y, z, out, seed++, backend);
+    });
+}
+
+} // namespace
+
+TEST_CASE("ベンチマーク: シンプレックスノイズのスループット") {
+    if (!ShouldRunBenchmarks()) {
+        return;
+    }
+    
+    constexpr int kSize = 16;
+    constexpr int kIterations = 64;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    for (int by = 0; by < kSize; ++by) {
+        for (int bz = 0; bz < kSize; ++bz) {
+            for (int bx = 0; bx < kSize; ++bx) {
+                x.push_back(static_cast<float>(bx) / 32.0f);
+                y.push_back(static_cast<float>(by) / 32.0f);
+                z.push_back(static_cast<float>(bz) / 32.0f);
+            }
+        }
+    }
+    std::vector<float> out(x.size());
+    
+    const double scalarRate = MeasureSamplesPerSecond(NoiseBackend::Scalar, x, y, z, out, kIterations);
+    spdlog::info("3Dシンプレックスノイズ: Scalar {:.2f} Msamples/s", scalarRate / 1e6);
+    for (const NoiseBackend backend : {NoiseBackend::Sse41, NoiseBackend::Avx2}) {
+        if (!IsNoiseBackendSupported(backend)) {
+            spdlog::info("  {}: このCPU・ビルドでは非対応", GetNoiseBackendName(backend));
+            continue;
+        }
+        const double rate = MeasureSamplesPerSecond(backend, x, y, z, out, kIterations);
+        spdlog::info("  {} {:.2f} Msamples/s ({:.1f}倍)", GetNoiseBackendName(backend), rate / 1e6, rate / scalarRate);
+        CHECK(rate > 0.0);
+    }
+    
+    // 地形生成で使う形（5オクターブのfBmを1チャンク分）
+    FractalNoiseSettings settings;
+    settings.octaves = 5;
+    std::vector<float> grid(kSize * kSize * kSize);
+    int originX = 0;
+    const double fractalRate = MeasureItemsPerSecond(1.0, kIterations, [&] {
+        FractalNoise3DGrid(settings, originX, 0, 0, kSize, kSize, kSize, grid);
+        originX += kSize;
+    });
+    spdlog::info("  fBm({}オクターブ, {}): {:.0f} chunks/s", settings.octaves,
+                 GetNoiseBackendName(GetBestNoiseBackend()), fractalRate);
+    CHECK(scalarRate > 0.0);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
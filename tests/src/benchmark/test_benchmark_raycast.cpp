@@ -0,0 +1,125 @@
+#include <doctest/doctest.h>
+#include "BenchmarkTiming.hpp"
+#include "world/TerrainGenerator.hpp"
+#include "world/VoxelRaycast.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 比較用: 1ステップごとにChunkManager::GetBlockでチャンクを検索するDDA（距離のみ返す）
+float RaycastWithLookupPerStep(const ChunkManager& chunks, const VoxelRay& ray) {
+    const float length = std::sqrt(ray.direction[0] * ray.direction[0] + ray.direction[1] * ray.direction[1] +
+                                   ray.direction[2] * ray.direction[2]);
+    int cell[3];
+    int step[3];
+    float tMax[3];
+    float tDelta[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        const float direction = ray.direction[axis] / length;
+        cell[axis] = static_cast<int>(std::floor(ray.origin[axis]));
+        step[axis] = direction > 0.0f ? 1 : -1;
+        tDelta[axis] = direction != 0.0f ? std::abs(1.0f / direction) : 1e30f;
+        const float boundary = direction > 0.0f ? static_cast<float>(cell[axis] + 1) - ray.origin[axis]
+                                                : ray.origin[axis] - static_cast<float>(cell[axis]);
+        tMax[axis] = boundary * tDelta[axis];
+    }
+    float distance = 0.0f;
+    while (chunks.GetBlock(cell[0], cell[1], cell[2]) == Blocks::Air) {
+        int axis = tMax[0] < tMax[1] ? 0 : 1;
+        if (tMax[2] < tMax[axis]) {
+            axis = 2;
+        }
+        distance = tMax[axis];
+        if (distance > ray.maxDistance) {
+            return -1.0f;
+        }
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+    }
+    return distance;
+}
+
+} // namespace
+
+TEST_CASE("ベンチマーク: ボクセルレイキャスト（視線判定相当の水平に近いレイ）") {
+    if (!ShouldRunBenchmarks()) {
+        return;
+    }
+    
+    // 地表を含む8×8列の地形
+    JobSystem generationJobs(1);
+    TerrainGenerator generator;
+    ChunkManager chunks;
+    std::vector<ChunkCoord> coords;
+    for (int cy = 2; cy <= 6; ++cy) {
+        for (int cz = 0; cz < 8; ++cz) {
+            for (int cx = 0; cx < 8; ++cx) {
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    generator.GenerateInto(generationJobs, coords, chunks);
+    
+    // 中央付近の地表の少し上から四方へ撃つレイ
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> horizontal(48.0f, 80.0f);
+    std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> vertical(-0.2f, 0.05f);
+    std::vector<VoxelRay> rays(512);
+    for (VoxelRay& ray : rays) {
+        ray.origin[0] = horizontal(random);
+        ray.origin[2] = horizontal(random);
+        ray.origin[1] = static_cast<float>(generator.FindTopSolidY(static_cast<int>(ray.origin[0]),
+                                                                   static_cast<int>(ray.origin[2]))) + 2.5f;
+        ray.direction[0] = direction(random);
+        ray.direction[1] = vertical(random);
+        ray.direction[2] = direction(random);
+        ray.maxDistance = 48.0f;
+    }
+    
+    // 結果の一致を確認してから計測する
+    std::vector<VoxelRaycastHit> hits(rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        hits[i] = RaycastVoxels(chunks, rays[i]);
+        CHECK(RaycastWithLookupPerStep(chunks, rays[i]) == (hits[i].hit ? hits[i].distance : -1.0f));
+    }
+    
+    constexpr int kRepeat = 20;
+    const auto rayCount = static_cast<double>(rays.size());
+    float sink = 0.0f;
+    const double lookupRate = MeasureItemsPerSecond(rayCount, kRepeat, [&] {
+        for (const VoxelRay& ray : rays) {
+            sink += RaycastWithLookupPerStep(chunks, ray);
+        }
+    });
+    const double cachedRate = MeasureItemsPerSecond(rayCount, kRepeat, [&] {
+        for (const VoxelRay& ray : rays) {
+            sink += RaycastVoxels(chunks, ray).distance;
+        }
+    });
+    spdlog::info("ボクセルレイキャスト ({}本 × {}回): 毎ステップ検索 {:.0f} rays/s / チャンク保持 {:.0f} rays/s ({:.2f}倍)",
+                 rays.size(), kRepeat, lookupRate, cachedRate, cachedRate / lookupRate);
+    
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (const unsigned threads : {2u, 4u}) {
+        JobSystem jobs(threads - 1);
+        const double batchRate = MeasureItemsPerSecond(rayCount, kRepeat, [&] {
+            RaycastVoxels(jobs, chunks, rays, hits);
+        });
+        spdlog::info("  一括処理 {}スレッド {:.0f} rays/s ({:.2f}倍、ハードウェア並列数 {})", threads, batchRate,
+                     batchRate / cachedRate, hardwareThreads);
+        CHECK(batchRate > 0.0);
+    }
+    CHECK(sink != 0.0f);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <doctest/doctest.h>
+#include "BenchmarkTiming.hpp"
+#include "world/TerrainGenerator.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 新しい生成器（列キャッシュ無し）でgenerateを1回実行した毎秒のチャンク数
+template <typename Function>
+double MeasureChunksPerSecond(const TerrainSettings& settings, std::size_t chunkCount, Function&& generate) {
+    TerrainGenerator generator(settings);
+    return MeasureItemsPerSecond(static_cast<double>(chunkCount), 1, [&] { generate(generator); });
+}
+
+} // namespace
+
+TEST_CASE("ベンチマーク: 地形生成のスレッド数ごとのスループット") {
+    if (!ShouldRunBenchmarks()) {
+        return;
+    }
+    
+    const TerrainSettings settings;
+    
+    // 地表を含む高さのチャンク（3Dノイズの評価が必要な層）
+    std::vector<ChunkCoord> coords;
+    for (int cy = 3; cy <= 5; ++cy) {
+        for (int cz = 0; cz < 6; ++cz) {
+            for (int cx = 0; cx < 6; ++cx) {
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    
+    // 1スレッドはジョブシステムを介さずに順に生成する
+    const double serialRate = MeasureChunksPerSecond(settings, coords.size(), [&](TerrainGenerator& generator) {
+        for (const ChunkCoord& coord : coords) {
+            generator.GetColumn(coord.x, coord.z);
+            generator.GenerateChunk(coord);
+        }
+    });
+    spdlog::info("地形生成 ({}チャンク): 1スレッド {:.0f} chunks/s", coords.size(), serialRate);
+    
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts = {2, 4};
+    if (hardwareThreads > 4) {
+        threadCounts.push_back(hardwareThreads);
+    }
+    for (const unsigned threads : threadCounts) {
+        JobSystem jobs(threads - 1);
+        const double rate = MeasureChunksPerSecond(settings, coords.size(), [&](TerrainGenerator& generator) {
+            generator.GenerateChunks(jobs, coords);
+        });
+        spdlog::info("  {}スレッド {:.0f} chunks/s ({:.2f}倍、ハードウェア並列数 {})", threads, rate, rate / serialRate,
+                     hardwareThreads);
+        CHECK(rate > 0.0);
+    }
+    CHECK(serialRate > 0.0);
+}
+
+TEST_CASE("ベンチマーク: 一様チャンクの省略による高さ256のワールド生成") {
+    if (!ShouldRunBenchmarks()) {
+        return;
+    }
+    
+    // 高さ256（16チャンク）の4×4列
+    std::vector<ChunkCoord> coords;
+    for (int cy = 0; cy < 16; ++cy) {
+        for (int cz = 0; cz < 4; ++cz) {
+            for (int cx = 0; cx < 4; ++cx) {
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    
+    JobSystem jobs(1);
+    TerrainSettings settings;
+    TerrainGenerator::Stats stats;
+    const double skipRate = MeasureChunksPerSecond(settings, coords.size(), [&](TerrainGenerator& generator) {
+        generator.GenerateChunks(jobs, coords);
+        stats = generator.GetStats();
+    });
+    settings.skipUniformChunks = false;
+    const double fullRate = MeasureChunksPerSecond(settings, coords.size(), [&](TerrainGenerator& generator) {
+        generator.GenerateChunks(jobs, coords);
+    });
+    
+    spdlog::info("高さ256のワールド生成 ({}チャンク): 省略あり {:.0f} chunks/s / 全評価 {:.0f} chunks/s ({:.1f}倍)",
+                 coords.size(), skipRate, fullRate, skipRate / fullRate);
+    spdlog::info("  空気 {} / 石 {} / 3Dノイズ評価 {}", stats.airChunks, stats.solidChunks, stats.noiseChunks);
+    CHECK(stats.noiseChunks < coords.size());
+    CHECK(skipRate > 0.0);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/HeadlessWindow.hpp"
+#include "mocks/MockWindow.hpp"
+#include "core/SpscRingBuffer.hpp"
+#include <memory>
+#include <thread>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("Applicationヘッドレス実行テスト - IWindow注入") {
+    SUBCASE("MockWindowで指定フレーム数だけメインループを駆動") {
+        auto window = std::make_unique<MockWindow>(640, 480, "Headless Mock");
+        MockWindow* mock = window.get();
+        
+        Application app(std::move(window));
+        app.RunFrames(10);
+        
+        CHECK(app.GetFrameCount() == 10);
+        CHECK(mock->GetPollEventsCallCount() == 10);
+        CHECK(mock->GetSwapBuffersCallCount() == 10);
+        
+        // 続けて実行するとフレーム数が積算される
+        app.RunFrames(5);
+        CHECK(app.GetFrameCount() == 15);
+        CHECK(mock->GetSwapBuffersCallCount() == 15);
+    }
+    
+    SUBCASE("ウィンドウが閉じられたらフレーム数に達する前に終了") {
+        auto window = std::make_unique<MockWindow>();
+        window->SetShouldClose(true);
+        
+        Application app(std::move(window));
+        app.RunFrames(100);
+        CHECK(app.GetFrameCount() == 0);
+    }
+    
+    SUBCASE("HeadlessWindowでGLコンテキスト無しに実行") {
+        auto window = std::make_unique<HeadlessWindow>(320, 240);
+        HeadlessWindow* headless = window.get();
+        CHECK_FALSE(headless->HasGraphicsContext());
+        
+        Application app(std::move(window));
+        app.RunFrames(3);
+        CHECK(headless->GetPresentedFrameCount() == 3);
+        
+        headless->RequestClose();
+        CHECK_NOTHROW(app.Run());
+        CHECK(app.GetFrameCount() == 3);
+    }
+}
+
+TEST_CASE("Application入力処理テスト - SPSCキュー経由でtickが入力を消費") {
+    auto window = std::make_unique<MockWindow>();
+    MockWindow* mock = window.get();
+    
+    ApplicationConfig config;
+    config.tickRate = 100000.0;  // ほぼ毎フレームtickが発生する頻度
+    Application app(std::move(window), config);
+    
+    InputEvent key;
+    key.type = InputEventType::Key;
+    key.code = 87;  // W
+    key.action = 1;
+    key.timestampNs = GetInputTimestamp();
+    CHECK(mock->PushInputEvent(key));
+    
+    // サイズ変更はキューを経由せず、最新値のみがビューポートへ反映される
+    mock->SetFramebufferSize(1024, 768);
+    mock->SetFramebufferSize(640, 480);
+    
+    app.RunFrames(100);
+    REQUIRE(app.GetTickCount() > 0);
+    CHECK(app.GetProcessedInputEventCount() == 1);
+    CHECK(app.GetInputLatencyHistogram().GetSampleCount() == 1);
+    CHECK(mock->GetInputEvents().ApproximateSize() == 0);
+    CHECK(app.GetViewportWidth() == 640);
+    CHECK(app.GetViewportHeight() == 480);
+}
+
+TEST_CASE("SpscRingBufferテスト - 容量・順序・並行転送") {
+    SUBCASE("FIFO順と容量上限") {
+        SpscRingBuffer<int, 4> buffer;
+        for (int i = 0; i < 4; ++i) {
+            CHECK(buffer.TryPush(i));
+        }
+        CHECK_FALSE(buffer.TryPush(4));
+        
+        int value = -1;
+        for (int i = 0; i < 4; ++i) {
+            CHECK(buffer.TryPop(value));
+            CHECK(value == i);
+        }
+        CHECK_FALSE(buffer.TryPop(value));
+    }
+    
+    SUBCASE("生産者・消費者スレッド間で順序を保って転送") {
+        SpscRingBuffer<int, 64> buffer;
+        constexpr int kCount = 100000;
+        std::thread producer([&buffer]() {
+            for (int i = 0; i < kCount; ++i) {
+                while (!buffer.TryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        
+        int expected = 0;
+        bool ordered = true;
+        int value = 0;
+        while (expected < kCount) {
+            if (buffer.TryPop(value)) {
+                ordered = ordered && value == expected;
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        CHECK(ordered);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
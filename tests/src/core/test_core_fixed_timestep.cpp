@@ -0,0 +1,50 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "core/FixedTimestep.hpp"
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("FixedTimestepテスト - 固定間隔シミュレーション") {
+    SUBCASE("経過時間に応じたtick数と補間係数") {
+        FixedTimestep timestep(20.0, 5);  // 50ms/tick
+        CHECK(timestep.GetTickDelta() == doctest::Approx(0.05));
+        
+        CHECK(timestep.Advance(0.02) == 0);
+        CHECK(timestep.GetAlpha() == doctest::Approx(0.4));
+        
+        CHECK(timestep.Advance(0.04) == 1);
+        CHECK(timestep.GetAlpha() == doctest::Approx(0.2));
+        
+        CHECK(timestep.Advance(0.1) == 2);
+        CHECK(timestep.GetTickCount() == 3);
+        CHECK(timestep.GetDroppedTickCount() == 0);
+    }
+    
+    SUBCASE("高負荷時は上限tick数で打ち切り残りを破棄") {
+        FixedTimestep timestep(60.0, 4);
+        
+        // 1秒の停止 = 60tick分だが4tickのみ実行
+        CHECK(timestep.Advance(1.0) == 4);
+        CHECK(timestep.GetDroppedTickCount() == 56);
+        CHECK(timestep.GetAlpha() >= 0.0f);
+        CHECK(timestep.GetAlpha() < 1.0f);
+        
+        // 次フレームへ負債を持ち越さない
+        CHECK(timestep.Advance(0.0) == 0);
+    }
+    
+    SUBCASE("負の経過時間は無視") {
+        FixedTimestep timestep(60.0, 5);
+        CHECK(timestep.Advance(-1.0) == 0);
+        CHECK(timestep.GetAlpha() == doctest::Approx(0.0));
+    }
+    
+    SUBCASE("不正な設定は例外") {
+        CHECK_THROWS_AS(FixedTimestep(0.0, 5), BoxelGameException);
+        CHECK_THROWS_AS(FixedTimestep(60.0, 0), BoxelGameException);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
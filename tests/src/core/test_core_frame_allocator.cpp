@@ -0,0 +1,142 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/FrameAllocator.hpp"
+#include "core/JobSystem.hpp"
+#include "mocks/MockWindow.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("LinearArenaテスト") {
+    SUBCASE("要求アラインメントを満たしアリーナ内から確保される") {
+        LinearArena arena(4096);
+        void* a = arena.allocate(3, 1);
+        void* b = arena.allocate(16, 16);
+        void* c = arena.allocate(8, 64);
+        
+        CHECK(reinterpret_cast<std::uintptr_t>(b) % 16 == 0);
+        CHECK(reinterpret_cast<std::uintptr_t>(c) % 64 == 0);
+        CHECK(a != b);
+        CHECK(arena.GetUsedBytes() >= 3 + 16 + 8);
+        CHECK(arena.GetUsedBytes() <= arena.GetCapacity());
+        CHECK(arena.GetOverflowCount() == 0);
+    }
+    
+    SUBCASE("pmrコンテナのアロケータとして使用できる") {
+        LinearArena arena(1 << 16);
+        std::pmr::vector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.size() == 1000);
+        CHECK(values[999] == 999);
+        CHECK(arena.GetUsedBytes() >= 1000 * sizeof(int));
+    }
+    
+    SUBCASE("Resetで使用量が0に戻りピーク使用量が記録される") {
+        LinearArena arena(1024);
+        CHECK(arena.allocate(100, 8) != nullptr);
+        arena.Reset();
+        CHECK(arena.GetUsedBytes() == 0);
+        CHECK(arena.GetLastFrameBytes() >= 100);
+        
+        CHECK(arena.allocate(500, 8) != nullptr);
+        arena.Reset();
+        CHECK(arena.allocate(10, 8) != nullptr);
+        arena.Reset();
+        CHECK(arena.GetLastFrameBytes() >= 10);
+        CHECK(arena.GetLastFrameBytes() < 100);
+        CHECK(arena.GetHighWaterMark() >= 500);
+    }
+    
+    SUBCASE("容量超過時はヒープへ退避し超過を記録する") {
+        LinearArena arena(256);
+        void* small = arena.allocate(200, 8);
+        void* large = arena.allocate(1000, 8);
+        CHECK(small != nullptr);
+        CHECK(large != nullptr);
+        CHECK(arena.GetOverflowCount() == 1);
+        CHECK(arena.GetUsedBytes() >= 1200);
+        
+        arena.Reset();
+        CHECK(arena.GetHighWaterMark() >= 1200);
+        CHECK(arena.GetUsedBytes() == 0);
+    }
+}
+
+TEST_CASE("FrameAllocatorテスト") {
+    SUBCASE("スレッド番号ごとのアリーナを並列に使用できる") {
+        JobSystem jobs(3);
+        FrameAllocator allocator(jobs.GetThreadCount(), 1 << 16);
+        std::atomic<int> wrongArena{0};
+        std::atomic<int> resetRejected{0};
+        
+        allocator.ParallelFor(jobs, 256, 4, [&](std::size_t begin, std::size_t end, LinearArena& arena) {
+            const int threadIndex = jobs.GetCurrentThreadIndex();
+            if (threadIndex < 0 || &arena != &allocator.GetArena(static_cast<unsigned>(threadIndex))) {
+                wrongArena.fetch_add(1);
+            }
+            std::pmr::vector<std::uint32_t> scratch(&arena);
+            for (std::size_t i = begin; i < end; ++i) {
+                scratch.push_back(static_cast<std::uint32_t>(i));
+            }
+            // 並列処理中の一括解放は拒否される
+            if (begin == 0) {
+                try {
+                    allocator.ResetAll();
+                } catch (const BoxelGameException&) {
+                    resetRejected.fetch_add(1);
+                }
+            }
+        });
+        CHECK(wrongArena.load() == 0);
+        CHECK(resetRejected.load() == 1);
+        
+        allocator.ResetAll();
+        CHECK(allocator.GetFrameCount() == 1);
+        CHECK(allocator.GetLastFrameBytes() > 0);
+        CHECK(allocator.GetHighWaterMark() == allocator.GetLastFrameBytes());
+        
+        allocator.ResetAll();
+        CHECK(allocator.GetLastFrameBytes() == 0);
+        CHECK(allocator.GetHighWaterMark() > 0);
+    }
+    
+    SUBCASE("Applicationはフレーム境界でアリーナを解放する") {
+        Application app(std::make_unique<MockWindow>());
+        LinearArena& arena = app.GetFrameArena();
+        CHECK(arena.allocate(4096, 16) != nullptr);
+        CHECK(arena.GetUsedBytes() >= 4096);
+        
+        app.RunFrames(1);
+        CHECK(arena.GetUsedBytes() == 0);
+        CHECK(app.GetFrameAllocator().GetHighWaterMark() >= 4096);
+    }
+    
+    SUBCASE("ワーカーからはApplicationのフレームアリーナを取得できない") {
+        Application app(std::make_unique<MockWindow>());
+        JobCounter counter;
+        std::atomic<int> threadIndex{-1};
+        std::atomic<bool> rejected{false};
+        app.GetJobSystem().Schedule([&]() {
+            threadIndex.store(app.GetJobSystem().GetCurrentThreadIndex());
+            try {
+                app.GetFrameArena();
+            } catch (const BoxelGameException&) {
+                rejected.store(true);
+            }
+        }, &counter);
+        app.GetJobSystem().Wait(counter);
+        // Wait中にメインスレッドが実行した場合（スレッド番号0）のみ取得できる
+        CHECK(rejected.load() == (threadIndex.load() != 0));
+        CHECK_NOTHROW(app.GetFrameArena());
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/FrameTimeRecorder.hpp"
+#include "mocks/MockWindow.hpp"
+#include <memory>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("FrameTimeRecorderテスト - フレーム時間統計") {
+    SUBCASE("記録が無い場合は空の統計") {
+        FrameTimeRecorder recorder;
+        const FrameTimeStatistics stats = recorder.ComputeStatistics();
+        CHECK(stats.sampleCount == 0);
+        CHECK(stats.averageFps == 0.0);
+    }
+    
+    SUBCASE("パーセンタイルと1% low") {
+        FrameTimeRecorder recorder;
+        // 1ms〜100msを1フレームずつ記録
+        for (int i = 100; i >= 1; --i) {
+            recorder.Record(i / 1000.0);
+        }
+        
+        const FrameTimeStatistics stats = recorder.ComputeStatistics();
+        CHECK(stats.sampleCount == 100);
+        CHECK(stats.minMs == doctest::Approx(1.0));
+        CHECK(stats.maxMs == doctest::Approx(100.0));
+        CHECK(stats.averageMs == doctest::Approx(50.5));
+        CHECK(stats.p50Ms == doctest::Approx(50.0));
+        CHECK(stats.p95Ms == doctest::Approx(95.0));
+        CHECK(stats.p99Ms == doctest::Approx(99.0));
+        CHECK(stats.averageFps == doctest::Approx(1000.0 / 50.5));
+        // 最も遅い1フレーム（100ms）= 10 FPS
+        CHECK(stats.onePercentLowFps == doctest::Approx(10.0));
+        
+        recorder.Reset();
+        CHECK(recorder.GetSampleCount() == 0);
+    }
+    
+    SUBCASE("容量を超えると古いフレームから上書きし、大きさは一定") {
+        FrameTimeRecorder recorder(4);
+        for (int i = 1; i <= 10; ++i) {
+            recorder.Record(i / 1000.0);
+        }
+        CHECK(recorder.GetCapacity() == 4);
+        CHECK(recorder.GetSampleCount() == 4);
+        CHECK(recorder.GetRecordedCount() == 10);
+        
+        // 直近4フレーム（7〜10ms）のみが対象
+        const FrameTimeStatistics stats = recorder.ComputeStatistics();
+        CHECK(stats.sampleCount == 4);
+        CHECK(stats.minMs == doctest::Approx(7.0));
+        CHECK(stats.maxMs == doctest::Approx(10.0));
+        CHECK(stats.averageMs == doctest::Approx(8.5));
+    }
+}
+
+TEST_CASE("Application提示モードテスト - 設定の適用とフレーム時間記録") {
+    auto window = std::make_unique<MockWindow>();
+    MockWindow* mock = window.get();
+    CHECK(mock->GetPresentMode() == PresentMode::VSync);
+    
+    ApplicationConfig config;
+    config.presentMode = PresentMode::Immediate;
+    Application app(std::move(window), config);
+    CHECK(mock->GetPresentMode() == PresentMode::Immediate);
+    
+    // 最初のフレームは計測起点のため記録されない
+    app.RunFrames(20);
+    CHECK(app.GetFrameTimeRecorder().GetSampleCount() == 19);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
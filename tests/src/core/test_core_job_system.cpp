@@ -0,0 +1,200 @@
+#include <doctest/doctest.h>
+#include "core/JobSystem.hpp"
+#include "core/WorkStealingDeque.hpp"
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("WorkStealingDequeテスト - 所有側LIFO・盗み側FIFO") {
+    WorkStealingDeque<int> deque(4);
+    int values[5] = {0, 1, 2, 3, 4};
+    
+    CHECK(deque.Pop() == nullptr);
+    CHECK(deque.Steal() == nullptr);
+    
+    for (int i = 0; i < 4; ++i) {
+        CHECK(deque.Push(&values[i]));
+    }
+    CHECK_FALSE(deque.Push(&values[4]));  // 容量超過
+    CHECK(deque.ApproximateSize() == 4);
+    
+    CHECK(deque.Steal() == &values[0]);
+    CHECK(deque.Pop() == &values[3]);
+    CHECK(deque.Steal() == &values[1]);
+    CHECK(deque.Pop() == &values[2]);
+    CHECK(deque.Pop() == nullptr);
+    
+    // 空になった後も再利用できる
+    CHECK(deque.Push(&values[4]));
+    CHECK(deque.Steal() == &values[4]);
+}
+
+TEST_CASE("WorkStealingDequeテスト - 並行スティールで要素が重複・欠落しない") {
+    constexpr int kItemCount = 20000;
+    WorkStealingDeque<int> deque(1 << 15);
+    std::vector<int> items(kItemCount);
+    std::vector<std::atomic<int>> taken(kItemCount);
+    std::atomic<bool> done{false};
+    
+    auto take = [&](int* item) { taken[static_cast<std::size_t>(item - items.data())].fetch_add(1); };
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&]() {
+            while (!done.load()) {
+                if (int* item = deque.Steal()) {
+                    take(item);
+                }
+            }
+            while (int* item = deque.Steal()) {
+                take(item);
+            }
+        });
+    }
+    
+    for (int i = 0; i < kItemCount; ++i) {
+        deque.Push(&items[static_cast<std::size_t>(i)]);
+        if (i % 3 == 0) {
+            if (int* item = deque.Pop()) {
+                take(item);
+            }
+        }
+    }
+    while (int* item = deque.Pop()) {
+        take(item);
+    }
+    done.store(true);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    
+    int duplicates = 0;
+    int missing = 0;
+    for (const auto& count : taken) {
+        duplicates += count.load() > 1 ? 1 : 0;
+        missing += count.load() == 0 ? 1 : 0;
+    }
+    CHECK(duplicates == 0);
+    CHECK(missing == 0);
+}
+
+TEST_CASE("JobSystemテスト - スケジューリングと待機") {
+    JobSystem jobs(3);
+    CHECK(jobs.GetWorkerCount() == 3);
+    CHECK(jobs.GetThreadCount() == 4);
+    CHECK(jobs.GetCurrentThreadIndex() == 0);
+    
+    SUBCASE("全ジョブが1回ずつ実行される") {
+        std::atomic<int> executed{0};
+        JobCounter counter;
+        for (int i = 0; i < 1000; ++i) {
+            jobs.Schedule([&executed]() { executed.fetch_add(1); }, &counter);
+        }
+        jobs.Wait(counter);
+        CHECK(counter.IsDone());
+        CHECK(executed.load() == 1000);
+    }
+    
+    SUBCASE("ジョブ内から子ジョブを投入できる") {
+        std::atomic<int> executed{0};
+        JobCounter counter;
+        for (int i = 0; i < 16; ++i) {
+            jobs.Schedule([&]() {
+                for (int j = 0; j < 16; ++j) {
+                    jobs.Schedule([&executed]() { executed.fetch_add(1); }, &counter);
+                }
+            }, &counter);
+        }
+        jobs.Wait(counter);
+        CHECK(executed.load() == 256);
+    }
+    
+    SUBCASE("依存ジョブは依存先の完了後に実行される") {
+        std::atomic<int> firstStage{0};
+        std::atomic<int> secondStageObserved{-1};
+        JobCounter stage1;
+        JobCounter stage2;
+        for (int i = 0; i < 64; ++i) {
+            jobs.Schedule([&firstStage]() {
+                std::this_thread::yield();
+                firstStage.fetch_add(1);
+            }, &stage1);
+        }
+        jobs.ScheduleAfter(stage1, [&]() { secondStageObserved.store(firstStage.load()); }, &stage2);
+        jobs.Wait(stage2);
+        CHECK(secondStageObserved.load() == 64);
+        
+        // 完了済みカウンタへの依存は即時投入される
+        std::atomic<bool> ran{false};
+        jobs.ScheduleAfter(stage1, [&ran]() { ran.store(true); }, &stage2);
+        jobs.Wait(stage2);
+        CHECK(ran.load());
+    }
+    
+    SUBCASE("ParallelForで範囲全体を分割処理") {
+        std::vector<int> values(10000);
+        jobs.ParallelFor(values.size(), 256, [&values](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                values[i] = static_cast<int>(i);
+            }
+        });
+        const long long sum = std::accumulate(values.begin(), values.end(), 0LL);
+        CHECK(sum == 9999LL * 10000LL / 2);
+    }
+    
+    SUBCASE("外部スレッドからの投入") {
+        std::atomic<int> executed{0};
+        JobCounter counter;
+        std::thread external([&]() {
+            CHECK(jobs.GetCurrentThreadIndex() == -1);
+            for (int i = 0; i < 100; ++i) {
+                jobs.Schedule([&executed]() { executed.fetch_add(1); }, &counter);
+            }
+        });
+        external.join();
+        jobs.Wait(counter);
+        CHECK(executed.load() == 100);
+    }
+    
+    SUBCASE("RunPendingJobは呼び出しスレッドでジョブを1つ実行する") {
+        // 全ワーカーを塞いでから投入し、メインスレッドが肩代わりすることを確かめる
+        std::atomic<int> busy{0};
+        std::atomic<bool> release{false};
+        JobCounter counter;
+        for (unsigned i = 0; i < jobs.GetWorkerCount(); ++i) {
+            jobs.Schedule([&]() {
+                busy.fetch_add(1);
+                while (!release.load()) {
+                    std::this_thread::yield();
+                }
+            }, &counter);
+        }
+        while (busy.load() < static_cast<int>(jobs.GetWorkerCount())) {
+            std::this_thread::yield();
+        }
+        
+        int executedOn = -1;
+        jobs.Schedule([&]() { executedOn = jobs.GetCurrentThreadIndex(); }, &counter);
+        CHECK(jobs.RunPendingJob());
+        CHECK(executedOn == 0);
+        CHECK_FALSE(jobs.RunPendingJob());
+        
+        release.store(true);
+        jobs.Wait(counter);
+    }
+    
+    SUBCASE("ジョブ内の例外はワーカーを停止させない") {
+        JobCounter counter;
+        std::atomic<bool> ran{false};
+        jobs.Schedule([]() { throw std::runtime_error("test"); }, &counter);
+        jobs.Schedule([&ran]() { ran.store(true); }, &counter);
+        jobs.Wait(counter);
+        CHECK(ran.load());
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <doctest/doctest.h>
+#include "core/LatencyHistogram.hpp"
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("LatencyHistogramテスト - 固定区間の遅延統計") {
+    LatencyHistogram histogram;
+    
+    SUBCASE("記録が無い場合は空の統計") {
+        const LatencyStatistics stats = histogram.ComputeStatistics();
+        CHECK(stats.sampleCount == 0);
+        CHECK(stats.maxMs == 0.0);
+    }
+    
+    SUBCASE("パーセンタイルは区間幅の精度で近似し、min/max/平均は正確") {
+        // 1ms〜100msを1件ずつ記録
+        for (int i = 100; i >= 1; --i) {
+            histogram.Record(i / 1000.0);
+        }
+        
+        const LatencyStatistics stats = histogram.ComputeStatistics();
+        CHECK(stats.sampleCount == 100);
+        CHECK(stats.minMs == doctest::Approx(1.0));
+        CHECK(stats.maxMs == doctest::Approx(100.0));
+        CHECK(stats.averageMs == doctest::Approx(50.5));
+        CHECK(stats.p50Ms == doctest::Approx(50.0).epsilon(0.01));
+        CHECK(stats.p95Ms == doctest::Approx(95.0).epsilon(0.01));
+        CHECK(stats.p99Ms == doctest::Approx(99.0).epsilon(0.01));
+        
+        histogram.Reset();
+        CHECK(histogram.GetSampleCount() == 0);
+        CHECK(histogram.ComputeStatistics().sampleCount == 0);
+    }
+    
+    SUBCASE("範囲外の遅延は最後の区間に数え、パーセンタイルは最大値") {
+        histogram.Record(0.001);
+        histogram.Record(2.0);
+        
+        const LatencyStatistics stats = histogram.ComputeStatistics();
+        CHECK(stats.sampleCount == 2);
+        CHECK(stats.maxMs == doctest::Approx(2000.0));
+        CHECK(stats.p99Ms == doctest::Approx(2000.0));
+        CHECK(stats.p50Ms <= 1.0 + LatencyHistogram::kBucketWidthMs);
+    }
+    
+    SUBCASE("記録件数によらず大きさは一定") {
+        for (int i = 0; i < 1000000; ++i) {
+            histogram.Record((i % 50) / 1000.0);
+        }
+        CHECK(histogram.GetSampleCount() == 1000000);
+        CHECK(histogram.ComputeStatistics().maxMs == doctest::Approx(49.0));
+        static_assert(sizeof(LatencyHistogram) < 16 * 1024);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
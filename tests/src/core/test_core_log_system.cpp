@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "core/Log.hpp"
+#include "core/LogSystem.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("LogSystemテスト - 非同期ログバックエンド") {
+    SUBCASE("非同期・同期の切り替え") {
+        LoggingConfig config;
+        LogSystem::Initialize(config);
+        CHECK(LogSystem::IsAsync());
+        
+        config.async = false;
+        LogSystem::Initialize(config);
+        CHECK_FALSE(LogSystem::IsAsync());
+        
+        LogSystem::Shutdown();
+        CHECK_FALSE(LogSystem::IsAsync());
+        CHECK_NOTHROW(spdlog::info("シャットダウン後の同期ログ"));
+    }
+    
+    SUBCASE("複数スレッドからの並行ログ") {
+        LoggingConfig config;
+        config.overflowPolicy = LogOverflowPolicy::Block;
+        LogSystem::Initialize(config);
+        
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([t]() {
+                for (int i = 0; i < 50; ++i) {
+                    BOXEL_LOG_INFO("非同期ログテスト スレッド{} メッセージ{}", t, i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        // Blockポリシーでは破棄されない
+        CHECK(LogSystem::GetDroppedMessageCount() == 0);
+        CHECK_NOTHROW(LogSystem::Shutdown());
+    }
+    
+    SUBCASE("ログ出力中の初期化・シャットダウンの繰り返し") {
+        // 停止したシンクはキューを解放するため、投入中のスレッドと競合しないこと
+        LoggingConfig config;
+        config.queueCapacity = 64;
+        std::atomic<bool> running{true};
+        std::thread writer([&running]() {
+            for (int i = 0; running.load(); ++i) {
+                BOXEL_LOG_INFO("再初期化テスト {}", i);
+            }
+        });
+        for (int i = 0; i < 20; ++i) {
+            LogSystem::Initialize(config);
+            LogSystem::Shutdown();
+        }
+        running.store(false);
+        writer.join();
+        CHECK_FALSE(LogSystem::IsAsync());
+    }
+    
+    SUBCASE("2のべき乗でないキュー容量は初期化エラー") {
+        LoggingConfig config;
+        for (const std::size_t capacity : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{1000}}) {
+            INFO("capacity ", capacity);
+            config.queueCapacity = capacity;
+            CHECK_THROWS_AS(LogSystem::Initialize(config), InitializationException);
+        }
+        
+        // 同期出力ではキューを使わないため容量を問わない
+        config.async = false;
+        CHECK_NOTHROW(LogSystem::Initialize(config));
+        LogSystem::Shutdown();
+    }
+    
+    SUBCASE("キュー満杯時は新しいメッセージを破棄して呼び出し側を止めない") {
+        LoggingConfig config;
+        config.queueCapacity = 2;
+        config.overflowPolicy = LogOverflowPolicy::DropNewest;
+        LogSystem::Initialize(config);
+        
+        for (int i = 0; i < 2000; ++i) {
+            BOXEL_LOG_INFO("破棄テスト {}", i);
+        }
+        WARN_MESSAGE(LogSystem::GetDroppedMessageCount() > 0, "書き込みスレッドが全メッセージに追いついたため破棄が発生しませんでした");
+        LogSystem::Shutdown();
+    }
+}
+
+TEST_CASE("Logマクロテスト - 無効レベルでは書式引数を評価しない") {
+    LoggingConfig config;
+    config.async = false;
+    config.level = spdlog::level::info;
+    LogSystem::Initialize(config);
+    
+    int evaluated = 0;
+    auto sideEffect = [&evaluated]() { return ++evaluated; };
+    
+    BOXEL_LOG_TRACE("trace {}", sideEffect());
+    BOXEL_LOG_DEBUG("debug {}", sideEffect());
+    CHECK(evaluated == 0);
+    
+    BOXEL_LOG_WARN("warn {}", sideEffect());
+    CHECK(evaluated == 1);
+    
+    LogSystem::Shutdown();
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
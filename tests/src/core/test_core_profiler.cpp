@@ -0,0 +1,95 @@
+#include <doctest/doctest.h>
+#include "core/Profiler.hpp"
+#include <string>
+#include <thread>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+std::size_t CountOccurrences(const std::string& text, const std::string& pattern) {
+    std::size_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Profilerテスト - ゾーン記録とChrome Trace出力") {
+    Profiler::Reset();
+    
+    SUBCASE("ネストしたゾーンが深さ付きで出力される") {
+        Profiler::MarkFrame();
+        {
+            ProfileScope outer("TestOuterZone");
+            ProfileScope inner("TestInnerZone");
+        }
+        
+        const std::string json = Profiler::ExportChromeTraceJson(1);
+        CHECK(json.front() == '{');
+        CHECK(json.back() == '}');
+        CHECK(json.find("\"traceEvents\"") != std::string::npos);
+        CHECK(CountOccurrences(json, "\"name\":\"TestOuterZone\"") == 1);
+        CHECK(CountOccurrences(json, "\"name\":\"TestInnerZone\"") == 1);
+        CHECK(json.find("\"depth\":1") != std::string::npos);
+    }
+    
+    SUBCASE("直近Nフレームのみ出力される") {
+        Profiler::MarkFrame();
+        { ProfileScope zone("TestOldFrameZone"); }
+        Profiler::MarkFrame();
+        { ProfileScope zone("TestNewFrameZone"); }
+        
+        const std::string lastFrame = Profiler::ExportChromeTraceJson(1);
+        CHECK(lastFrame.find("TestOldFrameZone") == std::string::npos);
+        CHECK(lastFrame.find("TestNewFrameZone") != std::string::npos);
+        
+        const std::string lastTwoFrames = Profiler::ExportChromeTraceJson(2);
+        CHECK(lastTwoFrames.find("TestOldFrameZone") != std::string::npos);
+    }
+    
+    SUBCASE("ワーカースレッドのゾーンはスレッド別に出力される") {
+        Profiler::MarkFrame();
+        std::thread worker([]() {
+            Profiler::SetThreadName("TestWorker");
+            ProfileScope zone("TestWorkerZone");
+        });
+        worker.join();
+        
+        const std::string json = Profiler::ExportChromeTraceJson(1);
+        CHECK(json.find("\"name\":\"TestWorker\"") != std::string::npos);
+        CHECK(json.find("TestWorkerZone") != std::string::npos);
+    }
+    
+    SUBCASE("終了したスレッドのバッファは再利用され、スレッドの入れ替わりで増えない") {
+        Profiler::MarkFrame();
+        const std::size_t before = CountOccurrences(Profiler::ExportChromeTraceJson(1), "\"thread_name\"");
+        for (int i = 0; i < 20; ++i) {
+            std::thread worker([]() { ProfileScope zone("TestChurnZone"); });
+            worker.join();
+        }
+        
+        const std::string json = Profiler::ExportChromeTraceJson(1);
+        CHECK(CountOccurrences(json, "\"thread_name\"") <= before + 1);
+        // 最後に終了したスレッドの記録は再利用されるまで出力される
+        CHECK(json.find("TestChurnZone") != std::string::npos);
+    }
+    
+    SUBCASE("リングバッファが一周しても最新のゾーンを保持") {
+        Profiler::MarkFrame();
+        for (int i = 0; i < 40000; ++i) {
+            ProfileScope zone("TestWrapZone");
+        }
+        { ProfileScope zone("TestLastZone"); }
+        
+        const std::string json = Profiler::ExportChromeTraceJson(1);
+        CHECK(json.find("TestLastZone") != std::string::npos);
+        CHECK(CountOccurrences(json, "TestWrapZone") < 40000);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/Exception.hpp"
+#include "core/StartupTrace.hpp"
+#include "mocks/MockWindow.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+const StartupPhaseRecord* FindPhase(const std::vector<StartupPhaseRecord>& phases, const std::string& name) {
+    const auto it = std::find_if(phases.begin(), phases.end(),
+                                 [&](const StartupPhaseRecord& phase) { return phase.name == name; });
+    return it != phases.end() ? &*it : nullptr;
+}
+
+} // namespace
+
+TEST_CASE("StartupTraceテスト") {
+    SUBCASE("フェーズが開始時刻順に記録される") {
+        StartupTrace trace;
+        {
+            StartupTrace::Phase phase(&trace, "A");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        {
+            StartupTrace::Phase phase(&trace, "B");
+        }
+        trace.Finish();
+        
+        const auto phases = trace.GetPhases();
+        REQUIRE(phases.size() == 2);
+        CHECK(phases[0].name == "A");
+        CHECK(phases[1].name == "B");
+        CHECK(phases[0].durationMs >= 1.0);
+        CHECK(phases[1].startMs >= phases[0].startMs + phases[0].durationMs);
+        CHECK(phases[0].onMainThread);
+        CHECK(trace.IsFinished());
+    }
+    
+    SUBCASE("Finish後は合計時間が固定される") {
+        StartupTrace trace;
+        trace.Finish();
+        const double total = trace.GetTotalSeconds();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        CHECK(trace.GetTotalSeconds() == total);
+    }
+    
+    SUBCASE("他スレッドで記録したフェーズはワーカーとして区別される") {
+        StartupTrace trace;
+        std::thread worker([&] { StartupTrace::Phase phase(&trace, "Worker"); });
+        worker.join();
+        
+        const auto phases = trace.GetPhases();
+        REQUIRE(phases.size() == 1);
+        CHECK_FALSE(phases[0].onMainThread);
+    }
+    
+    SUBCASE("nullptrのトレースには何も記録しない") {
+        CHECK_NOTHROW(StartupTrace::Phase(nullptr, "Ignored"));
+    }
+}
+
+TEST_CASE("Application起動フェーズ計測テスト") {
+    SUBCASE("各起動フェーズが記録され起動完了時に計測が終了する") {
+        Application app(std::make_unique<MockWindow>());
+        const StartupTrace& trace = app.GetStartupTrace();
+        CHECK(trace.IsFinished());
+        
+        const auto phases = trace.GetPhases();
+        CHECK(FindPhase(phases, "ログ初期化") != nullptr);
+        CHECK(FindPhase(phases, "ジョブシステム初期化") != nullptr);
+        CHECK(FindPhase(phases, "ウィンドウ初期化") != nullptr);
+        CHECK(FindPhase(phases, "起動タスク待機") != nullptr);
+    }
+    
+    SUBCASE("起動タスクはジョブワーカーで実行され完了後にコンストラクタが戻る") {
+        std::atomic<int> completed{0};
+        ApplicationConfig config;
+        config.workerThreadCount = 2;
+        for (int i = 0; i < 4; ++i) {
+            config.startupTasks.push_back({"Task" + std::to_string(i), [&completed] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                completed.fetch_add(1);
+            }});
+        }
+        
+        Application app(std::make_unique<MockWindow>(), config);
+        CHECK(completed.load() == 4);
+        
+        const auto phases = app.GetStartupTrace().GetPhases();
+        for (int i = 0; i < 4; ++i) {
+            CHECK(FindPhase(phases, "Task" + std::to_string(i)) != nullptr);
+        }
+    }
+    
+    SUBCASE("起動タスクの例外は初期化例外として通知される") {
+        ApplicationConfig config;
+        config.startupTasks.push_back({"Broken", [] { throw std::runtime_error("asset missing"); }});
+        config.startupTasks.push_back({"Fine", [] {}});
+        
+        CHECK_THROWS_AS(Application(std::make_unique<MockWindow>(), config), InitializationException);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include <doctest/doctest.h>
+#include "render/RenderBackend.hpp"
+#include "render/VoxelVertex.hpp"
+#include <spdlog/spdlog.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// OpenGL関連のインクルード
+#include <glad/gl.h>       // GLADを先に読み込み
+#define GLFW_INCLUDE_NONE // GLFWにOpenGLヘッダーを含めさせない
+#include <GLFW/glfw3.h> // GLFWはGLADの後
+
+bool isCI();  // test_main.cpp
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+std::string ReadShaderSource(const std::string& name) {
+    std::ifstream file(std::string(BOXEL_TEST_ASSETS_DIR) + "/shaders/" + name);
+    INFO("シェーダーファイル: ", name);
+    REQUIRE(file.is_open());
+    std::stringstream source;
+    source << file.rdbuf();
+    return source.str();
+}
+
+// コンパイルに失敗した場合はログを付けて失敗させる
+GLuint CompileShader(GLenum type, const std::string& name) {
+    const std::string source = ReadShaderSource(name);
+    const char* text = source.c_str();
+    const GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &text, nullptr);
+    glCompileShader(shader);
+    
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled != GL_TRUE) {
+        char log[1024] = {};
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        FAIL_CHECK(name + " のコンパイル失敗: " + log);
+    }
+    return shader;
+}
+
+// 描画に使うものと同じ OpenGL 4.1 Core のコンテキストを非表示ウィンドウで作る（作れなければnullptr）
+GLFWwindow* CreateHiddenContext() {
+    if (!glfwInit()) {
+        return nullptr;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(64, 64, "Voxel Shader Test", nullptr, nullptr);
+    if (!window) {
+        return nullptr;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGL(glfwGetProcAddress)) {
+        glfwDestroyWindow(window);
+        return nullptr;
+    }
+    return window;
+}
+
+} // namespace
+
+// =============================================================================
+// 統合テスト（ローカル環境のみ実行、OpenGL 4.1 Coreのコンテキストが必要）
+// =============================================================================
+
+TEST_CASE("ボクセルシェーダーテスト - コンパイル・リンクと頂点属性の設定") {
+    if (isCI()) {
+        return;
+    }
+    GLFWwindow* window = CreateHiddenContext();
+    if (!window) {
+        MESSAGE("OpenGL 4.1 Coreのコンテキストを作成できないためスキップ");
+        return;
+    }
+    
+    const GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, "voxel.vert");
+    const GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, "voxel.frag");
+    const GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) {
+        char log[1024] = {};
+        glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        FAIL_CHECK(std::string("ボクセルシェーダーのリンク失敗: ") + log);
+    }
+    // 頂点シェーダーの入力位置はC++側の定数と一致すること
+    CHECK(glGetAttribLocation(program, "aPacked") == static_cast<GLint>(kVoxelVertexAttributeLocation));
+    
+    // VAOにPackedVoxelVertexの属性（整数uvec2）を設定する
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(kVoxelVertexStride * kVerticesPerQuad), nullptr,
+                 GL_STATIC_DRAW);
+    RenderBackend::SetVoxelVertexLayout();
+    CHECK(glGetError() == GL_NO_ERROR);
+    
+    GLint enabled = 0;
+    GLint integer = 0;
+    GLint size = 0;
+    GLint stride = 0;
+    glGetVertexAttribiv(kVoxelVertexAttributeLocation, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    glGetVertexAttribiv(kVoxelVertexAttributeLocation, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &integer);
+    glGetVertexAttribiv(kVoxelVertexAttributeLocation, GL_VERTEX_ATTRIB_ARRAY_SIZE, &size);
+    glGetVertexAttribiv(kVoxelVertexAttributeLocation, GL_VERTEX_ATTRIB_ARRAY_STRIDE, &stride);
+    CHECK(enabled == GL_TRUE);
+    CHECK(integer == GL_TRUE);
+    CHECK(size == kVoxelVertexComponentCount);
+    CHECK(stride == static_cast<GLint>(kVoxelVertexStride));
+    
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glfwDestroyWindow(window);
+    spdlog::info("ボクセルシェーダーのコンパイル・リンクを確認しました");
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
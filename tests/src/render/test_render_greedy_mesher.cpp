@@ -0,0 +1,254 @@
+#include <doctest/doctest.h>
+#include "render/GreedyMesher.hpp"
+#include "world/BlockRegistry.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/PaddedChunk.hpp"
+#include <memory>
+#include <random>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("PaddedChunk構築テスト") {
+    SUBCASE("中心チャンクと隣接チャンクの境界面を取り込む") {
+        ChunkManager manager;
+        Chunk& center = manager.GetOrCreate({0, 0, 0});
+        center.Set(0, 0, 0, Blocks::Stone);
+        center.Set(15, 15, 15, Blocks::Dirt);
+        manager.GetOrCreate({1, 0, 0}, Blocks::Sand);
+        manager.GetOrCreate({0, -1, 0}).Set(4, 15, 5, Blocks::Grass);
+        manager.GetOrCreate({-1, -1, -1}).Set(15, 15, 15, Blocks::Glass);
+        
+        PaddedChunk padded;
+        padded.Build(manager.GetNeighborhood({0, 0, 0}));
+        CHECK(padded.Get(0, 0, 0) == Blocks::Stone);
+        CHECK(padded.Get(15, 15, 15) == Blocks::Dirt);
+        CHECK(padded.Get(16, 7, 3) == Blocks::Sand);
+        CHECK(padded.Get(4, -1, 5) == Blocks::Grass);
+        CHECK(padded.Get(-1, -1, -1) == Blocks::Glass);
+        CHECK(padded.Get(-1, 3, 3) == Blocks::Air);
+        CHECK(padded.Get(3, 16, 3) == Blocks::Air);
+    }
+}
+
+TEST_CASE("GreedyMesherテスト") {
+    GreedyMesher mesher;
+    ChunkMesh mesh;
+    
+    SUBCASE("空のチャンクは面を生成しない") {
+        PaddedChunk padded;
+        mesher.Mesh(padded, mesh);
+        CHECK(mesh.IsEmpty());
+    }
+    
+    SUBCASE("単一ブロックは6面") {
+        PaddedChunk padded;
+        padded.Set(3, 4, 5, Blocks::Stone);
+        mesher.Mesh(padded, mesh);
+        REQUIRE(mesh.GetQuadCount() == 6);
+        for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+            const MeshQuad quad = mesh.GetQuad(i);
+            CHECK(quad.x == 3);
+            CHECK(quad.y == 4);
+            CHECK(quad.z == 5);
+            CHECK(quad.width == 1);
+            CHECK(quad.height == 1);
+            CHECK(quad.textureLayer == GetBlockTextureLayer(Blocks::Stone, quad.face));
+        }
+    }
+    
+    SUBCASE("満たされたチャンクは周囲が空なら6枚の16×16四角形") {
+        PaddedChunk padded;
+        for (int y = 0; y < kChunkSize; ++y) {
+            for (int z = 0; z < kChunkSize; ++z) {
+                for (int x = 0; x < kChunkSize; ++x) {
+                    padded.Set(x, y, z, Blocks::Stone);
+                }
+            }
+        }
+        mesher.Mesh(padded, mesh);
+        REQUIRE(mesh.GetQuadCount() == 6);
+        for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+            const MeshQuad quad = mesh.GetQuad(i);
+            CHECK(quad.width == kChunkSize);
+            CHECK(quad.height == kChunkSize);
+        }
+        CHECK(mesh.CountFaces() == 6 * kChunkSize * kChunkSize);
+        
+        // 周囲も不透明なら全ての面が隠れる
+        padded.blocks.fill(Blocks::Stone);
+        mesher.Mesh(padded, mesh);
+        CHECK(mesh.IsEmpty());
+    }
+    
+    SUBCASE("異なる種別の面は統合しない") {
+        PaddedChunk padded;
+        for (int x = 0; x < kChunkSize; ++x) {
+            padded.Set(x, 0, 0, x < 8 ? Blocks::Stone : Blocks::Dirt);
+        }
+        mesher.Mesh(padded, mesh);
+        
+        int topQuads = 0;
+        for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+            const MeshQuad quad = mesh.GetQuad(i);
+            if (quad.face == BlockFace::PositiveY) {
+                ++topQuads;
+                CHECK(quad.width == 8);
+            }
+        }
+        CHECK(topQuads == 2);
+    }
+    
+    SUBCASE("角の遮蔽に応じたAOを持ち、AOの異なる面は統合しない") {
+        PaddedChunk padded;
+        for (int z = 0; z < kChunkSize; ++z) {
+            for (int x = 0; x < kChunkSize; ++x) {
+                padded.Set(x, 0, z, Blocks::Stone);
+            }
+        }
+        mesher.Mesh(padded, mesh);
+        int topQuads = 0;
+        for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+            const MeshQuad quad = mesh.GetQuad(i);
+            topQuads += quad.face == BlockFace::PositiveY ? 1 : 0;
+            CHECK(quad.ambientOcclusion == kNoAmbientOcclusion);
+        }
+        CHECK(topQuads == 1);
+        
+        // 床の上に1ブロック置くと、その周囲の床の上面の角が暗くなる
+        padded.Set(8, 1, 8, Blocks::Stone);
+        mesher.Mesh(padded, mesh);
+        const auto findTopQuad = [&](int x, int z) {
+            for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+                const MeshQuad quad = mesh.GetQuad(i);
+                if (quad.face == BlockFace::PositiveY && quad.y == 0 && quad.x <= x && x < quad.x + quad.width &&
+                    quad.z <= z && z < quad.z + quad.height) {
+                    return quad;
+                }
+            }
+            FAIL("上面の四角形が見つからない");
+            return MeshQuad{};
+        };
+        
+        // 西隣の面: +u側の2角が辺1つで遮蔽される
+        const MeshQuad west = findTopQuad(7, 8);
+        CHECK(west.width == 1);
+        CHECK(west.height == 1);
+        CHECK(GetCornerAmbientOcclusion(west.ambientOcclusion, 0, 0) == 3);
+        CHECK(GetCornerAmbientOcclusion(west.ambientOcclusion, 1, 0) == 2);
+        CHECK(GetCornerAmbientOcclusion(west.ambientOcclusion, 1, 1) == 2);
+        CHECK(GetCornerAmbientOcclusion(west.ambientOcclusion, 0, 1) == 3);
+        
+        // 斜め隣の面: 角1つだけが遮蔽される
+        const MeshQuad diagonal = findTopQuad(9, 9);
+        CHECK(GetCornerAmbientOcclusion(diagonal.ambientOcclusion, 0, 0) == 2);
+        CHECK(GetCornerAmbientOcclusion(diagonal.ambientOcclusion, 1, 1) == 3);
+        
+        // 離れた面は遮蔽無しのまま大きく統合される
+        const MeshQuad far = findTopQuad(0, 0);
+        CHECK(far.ambientOcclusion == kNoAmbientOcclusion);
+        CHECK(far.width * far.height >= 7 * 7);
+    }
+    
+    SUBCASE("ガラス・葉・松明に接する面は隠さず、AOの遮蔽物にもならない") {
+        const auto countFaces = [&](BlockFace face, int x, int y, int z, std::uint16_t layer) {
+            int count = 0;
+            for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+                const MeshQuad quad = mesh.GetQuad(i);
+                count += quad.face == face && quad.x == x && quad.y == y && quad.z == z && quad.textureLayer == layer
+                    ? 1 : 0;
+            }
+            return count;
+        };
+        
+        for (const BlockId neighbor : {Blocks::Glass, Blocks::Leaves, Blocks::Torch}) {
+            INFO("neighbor ", GetBlockName(neighbor));
+            PaddedChunk padded;
+            padded.Set(3, 4, 5, Blocks::Stone);
+            padded.Set(4, 4, 5, neighbor);
+            mesher.Mesh(padded, mesh);
+            
+            // 石は6面全てを持ち、隣のブロックは石に接する面のみ隠れる
+            REQUIRE(mesh.GetQuadCount() == 11);
+            CHECK(countFaces(BlockFace::PositiveX, 3, 4, 5, GetBlockTextureLayer(Blocks::Stone, BlockFace::PositiveX)) == 1);
+            CHECK(countFaces(BlockFace::NegativeX, 4, 4, 5, GetBlockTextureLayer(neighbor, BlockFace::NegativeX)) == 0);
+            for (std::size_t i = 0; i < mesh.GetQuadCount(); ++i) {
+                CHECK(mesh.GetQuad(i).ambientOcclusion == kNoAmbientOcclusion);
+            }
+            
+            ChunkMesh reference;
+            NaiveMesher::Mesh(padded, reference);
+            CHECK(mesh.vertices == reference.vertices);
+        }
+    }
+    
+    SUBCASE("ランダムなチャンクで参照実装と同一の出力") {
+        std::mt19937 rng(7);
+        ChunkMesh reference;
+        for (int trial = 0; trial < 20; ++trial) {
+            // 密度と種類数を変えて統合・分割の両経路を通す（後半は透明・非不透明のブロックも含む）
+            std::uniform_int_distribution<int> density(0, 99);
+            const int solidPercent = 10 + trial * 4;
+            const int typeCount = 1 + trial % static_cast<int>(kBlockTypeCount - 1);
+            PaddedChunk padded;
+            for (BlockId& block : padded.blocks) {
+                block = density(rng) < solidPercent ? static_cast<BlockId>(1 + rng() % typeCount) : Blocks::Air;
+            }
+            
+            mesher.Mesh(padded, mesh);
+            NaiveMesher::Mesh(padded, reference);
+            INFO("trial ", trial);
+            CHECK(mesh.vertices == reference.vertices);
+        }
+    }
+}
+
+TEST_CASE("GreedyMesher差分更新テスト") {
+    SUBCASE("ブロック変更後のスライス差し替えは全体の再生成と一致する") {
+        std::mt19937 rng(99);
+        std::uniform_int_distribution<int> coordinate(-1, kChunkSize);
+        std::uniform_int_distribution<int> blockType(0, 3);
+        
+        ChunkManager manager;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    Chunk& chunk = manager.GetOrCreate({dx, dy, dz});
+                    for (int i = 0; i < kChunkVolume; ++i) {
+                        if (rng() % 2 == 0) {
+                            chunk.SetByIndex(i, static_cast<BlockId>(1 + rng() % 3));
+                        }
+                    }
+                }
+            }
+        }
+        
+        GreedyMesher mesher;
+        PaddedChunk padded;
+        ChunkMesh mesh;
+        ChunkMesh expected;
+        padded.Build(manager.GetNeighborhood({0, 0, 0}));
+        mesher.Mesh(padded, mesh);
+        
+        int mismatches = 0;
+        for (int edit = 0; edit < 200; ++edit) {
+            // 中心チャンク内と、面・辺・角で接する隣接チャンクの境界ブロックを変更する（AOは斜めも参照する）
+            const int x = coordinate(rng);
+            const int y = coordinate(rng);
+            const int z = coordinate(rng);
+            manager.SetBlock(x, y, z, static_cast<BlockId>(blockType(rng)));
+            
+            const ChunkNeighborhood neighborhood = manager.GetNeighborhood({0, 0, 0});
+            const int rebuiltSlices = mesher.RemeshAroundBlock(neighborhood, x, y, z, mesh);
+            padded.Build(neighborhood);
+            mesher.Mesh(padded, expected);
+            if (rebuiltSlices > 12 || mesh.vertices != expected.vertices || mesh.sliceOffsets != expected.sliceOffsets) {
+                ++mismatches;
+            }
+        }
+        CHECK(mismatches == 0);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
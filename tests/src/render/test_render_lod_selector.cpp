@@ -0,0 +1,117 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "render/LodSelector.hpp"
+#include <unordered_map>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 範囲内の各チャンクを覆う領域の数（重なり・隙間の確認用）
+std::unordered_map<std::uint64_t, int> CountCoverage(const std::vector<LodNode>& nodes,
+                                                     const ChunkCoord& minChunk, const ChunkCoord& maxChunk) {
+    std::unordered_map<std::uint64_t, int> coverage;
+    for (const LodNode& node : nodes) {
+        const int scale = GetLodScale(node.level);
+        const ChunkCoord origin = GetLodRegionOrigin(node.region, node.level);
+        for (int y = origin.y; y < origin.y + scale; ++y) {
+            for (int z = origin.z; z < origin.z + scale; ++z) {
+                for (int x = origin.x; x < origin.x + scale; ++x) {
+                    if (x >= minChunk.x && x <= maxChunk.x && y >= minChunk.y && y <= maxChunk.y &&
+                        z >= minChunk.z && z <= maxChunk.z) {
+                        ++coverage[PackChunkCoord({x, y, z})];
+                    }
+                }
+            }
+        }
+    }
+    return coverage;
+}
+
+int FindLevel(const std::vector<LodNode>& nodes, const ChunkCoord& chunk) {
+    for (const LodNode& node : nodes) {
+        if (ToLodRegion(chunk, node.level) == node.region) {
+            return node.level;
+        }
+    }
+    return -1;
+}
+
+} // namespace
+
+TEST_CASE("LodSelectorテスト") {
+    const ChunkCoord minChunk{-40, -2, -40};
+    const ChunkCoord maxChunk{39, 1, 39};
+    std::vector<LodNode> nodes;
+    
+    SUBCASE("選ばれた領域は範囲内の全チャンクをちょうど1回ずつ覆う") {
+        LodSelector selector;
+        selector.Select(5.0f, 3.0f, -7.0f, minChunk, maxChunk, nodes);
+        const auto coverage = CountCoverage(nodes, minChunk, maxChunk);
+        CHECK(coverage.size() == 80u * 4u * 80u);
+        int overlaps = 0;
+        for (const auto& [key, count] : coverage) {
+            overlaps += count != 1 ? 1 : 0;
+        }
+        CHECK(overlaps == 0);
+    }
+    
+    SUBCASE("視点付近は詳細、遠方ほど粗いレベル") {
+        LodSelector selector;
+        selector.Select(8.0f, 8.0f, 8.0f, minChunk, maxChunk, nodes);
+        CHECK(FindLevel(nodes, {0, 0, 0}) == 0);
+        CHECK(FindLevel(nodes, {4, 0, 0}) == 0);
+        CHECK(FindLevel(nodes, {-39, 0, 0}) == kMaxLodLevel);
+        CHECK(FindLevel(nodes, {39, 0, 39}) >= 2);
+        
+        // 全チャンクをレベル0で描く場合より十分少ない領域数
+        CHECK(nodes.size() * 8 < 80u * 4u * 80u);
+    }
+    
+    SUBCASE("閾値付近の小さな移動では切り替わらない") {
+        LodSelector::Config config;
+        config.level1Distance = 4.0f;
+        config.hysteresis = 1.0f;
+        config.maxLevel = 1;
+        LodSelector selector(config);
+        const ChunkCoord rangeMin{0, 0, 0};
+        const ChunkCoord rangeMax{1, 0, 1};
+        
+        // 領域(0,0,0)の最近点（x = 32ブロック）から4チャンク先で切り替わる
+        const float threshold = 32.0f + 4.0f * kChunkSize;
+        selector.Select(threshold + 1.0f, 8.0f, 8.0f, rangeMin, rangeMax, nodes);
+        REQUIRE(nodes.size() == 1);
+        CHECK(nodes[0].level == 1);
+        
+        // 不感帯内で閾値を跨いでも粗いまま
+        selector.Select(threshold - 8.0f, 8.0f, 8.0f, rangeMin, rangeMax, nodes);
+        CHECK(nodes.size() == 1);
+        CHECK(selector.GetSwitchCount() == 0);
+        
+        // 不感帯を抜けると分割される
+        selector.Select(threshold - 24.0f, 8.0f, 8.0f, rangeMin, rangeMax, nodes);
+        CHECK(nodes.size() == 4);
+        CHECK(selector.GetSwitchCount() == 1);
+        
+        // 戻る方向も閾値 + 幅を超えるまで分割したまま
+        selector.Select(threshold + 8.0f, 8.0f, 8.0f, rangeMin, rangeMax, nodes);
+        CHECK(nodes.size() == 4);
+        selector.Select(threshold + 24.0f, 8.0f, 8.0f, rangeMin, rangeMax, nodes);
+        CHECK(nodes.size() == 1);
+        CHECK(selector.GetSwitchCount() == 2);
+    }
+    
+    SUBCASE("不正な設定は例外") {
+        LodSelector::Config config;
+        config.maxLevel = kMaxLodLevel + 1;
+        CHECK_THROWS_AS(LodSelector{config}, InitializationException);
+        config.maxLevel = kMaxLodLevel;
+        config.hysteresis = config.level1Distance;
+        CHECK_THROWS_AS(LodSelector{config}, InitializationException);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
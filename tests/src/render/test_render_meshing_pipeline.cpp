@@ -0,0 +1,251 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/JobSystem.hpp"
+#include "mocks/MockWindow.hpp"
+#include "render/GreedyMesher.hpp"
+#include "render/MeshingPipeline.hpp"
+#include "world/BlockRegistry.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 要求が全て片付くまでUpdateを繰り返す（タイムアウト付き）
+void UpdateUntilIdle(MeshingPipeline& pipeline, const ChunkManager& chunks, std::vector<CompletedChunkMesh>& out) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    do {
+        pipeline.Update(chunks, out);
+        if (pipeline.GetJobsInFlight() == 0 && pipeline.GetPendingCount() == 0) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    } while (std::chrono::steady_clock::now() < deadline);
+    FAIL("メッシュ生成がタイムアウト");
+}
+
+void MakeTerrainChunk(ChunkManager& chunks, const ChunkCoord& coord) {
+    Chunk& chunk = chunks.GetOrCreate(coord);
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int x = 0; x < kChunkSize; ++x) {
+            const int height = 4 + (x * 3 + z * 5 + coord.x) % 7;
+            for (int y = 0; y < height; ++y) {
+                chunk.Set(x, y, z, y + 1 == height ? Blocks::Grass : Blocks::Stone);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("MeshingPipelineテスト") {
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    std::vector<CompletedChunkMesh> completed;
+    
+    SUBCASE("ワーカーで生成したメッシュは同期生成と一致する") {
+        MeshingPipeline pipeline(jobs, 4);
+        for (int x = 0; x < 3; ++x) {
+            MakeTerrainChunk(chunks, {x, 0, 0});
+            pipeline.Request({x, 0, 0});
+        }
+        UpdateUntilIdle(pipeline, chunks, completed);
+        REQUIRE(completed.size() == 3);
+        CHECK(pipeline.GetCompletedCount() == 3);
+        
+        GreedyMesher mesher;
+        for (const CompletedChunkMesh& result : completed) {
+            PaddedChunk padded;
+            padded.Build(chunks.GetNeighborhood(result.coord));
+            ChunkMesh expected;
+            mesher.Mesh(padded, expected);
+            CHECK(result.mesh.vertices == expected.vertices);
+        }
+    }
+    
+    SUBCASE("視点に近いチャンクから投入される") {
+        MeshingPipeline pipeline(jobs, 1);
+        for (int x : {8, 0, 4, 2}) {
+            MakeTerrainChunk(chunks, {x, 0, 0});
+            pipeline.Request({x, 0, 0});
+        }
+        pipeline.SetViewerPosition(0.0f, 0.0f, 0.0f);
+        UpdateUntilIdle(pipeline, chunks, completed);
+        
+        REQUIRE(completed.size() == 4);
+        CHECK(completed[0].coord.x == 0);
+        CHECK(completed[1].coord.x == 2);
+        CHECK(completed[2].coord.x == 4);
+        CHECK(completed[3].coord.x == 8);
+    }
+    
+    SUBCASE("スナップショット後に変更されたチャンクは作り直される") {
+        MeshingPipeline pipeline(jobs, 4);
+        MakeTerrainChunk(chunks, {0, 0, 0});
+        pipeline.Request({0, 0, 0});
+        pipeline.Update(chunks, completed);
+        CHECK(pipeline.GetJobsInFlight() == 1);
+        
+        chunks.SetBlock(8, 15, 8, Blocks::Glass);
+        UpdateUntilIdle(pipeline, chunks, completed);
+        REQUIRE(completed.size() == 1);
+        CHECK(pipeline.GetDiscardedCount() == 1);
+        
+        bool hasGlass = false;
+        for (const PackedVoxelVertex& vertex : completed[0].mesh.vertices) {
+            hasGlass = hasGlass || vertex.GetTextureLayer() == GetBlockTextureLayer(Blocks::Glass, BlockFace::PositiveY);
+        }
+        CHECK(hasGlass);
+    }
+    
+    SUBCASE("アンロード・取り消し・再要求で古い結果は破棄される") {
+        MeshingPipeline pipeline(jobs, 4);
+        MakeTerrainChunk(chunks, {0, 0, 0});
+        MakeTerrainChunk(chunks, {1, 0, 0});
+        MakeTerrainChunk(chunks, {2, 0, 0});
+        
+        pipeline.Request({0, 0, 0});
+        pipeline.Request({1, 0, 0});
+        pipeline.Update(chunks, completed);
+        chunks.Remove({0, 0, 0});
+        pipeline.Cancel({1, 0, 0});
+        
+        pipeline.Request({2, 0, 0});
+        pipeline.Request({2, 0, 0});
+        UpdateUntilIdle(pipeline, chunks, completed);
+        
+        REQUIRE(completed.size() == 1);
+        CHECK(completed[0].coord == ChunkCoord{2, 0, 0});
+        CHECK(pipeline.GetDiscardedCount() == 2);
+    }
+    
+    SUBCASE("LOD領域は縮小したスナップショットから同じメッシャーで生成される") {
+        MeshingPipeline pipeline(jobs, 4);
+        for (int z = 0; z < 2; ++z) {
+            for (int x = 0; x < 2; ++x) {
+                MakeTerrainChunk(chunks, {x, 0, z});
+            }
+        }
+        pipeline.Request({0, 0, 0}, 1);
+        pipeline.Request({0, 0, 0});
+        UpdateUntilIdle(pipeline, chunks, completed);
+        REQUIRE(completed.size() == 2);
+        
+        const auto lod = std::find_if(completed.begin(), completed.end(),
+                                      [](const CompletedChunkMesh& result) { return result.lodLevel == 1; });
+        REQUIRE(lod != completed.end());
+        GreedyMesher mesher;
+        PaddedChunk padded;
+        ChunkMesh expected;
+        BuildLodChunk(chunks, {0, 0, 0}, 1, padded);
+        mesher.Mesh(padded, expected);
+        CHECK(lod->mesh.vertices == expected.vertices);
+        
+        // 領域内の別チャンクの変更でもLODメッシュは作り直される
+        pipeline.Request({0, 0, 0}, 1);
+        pipeline.Update(chunks, completed);
+        chunks.SetBlock(20, 15, 20, Blocks::Glass);
+        completed.clear();
+        UpdateUntilIdle(pipeline, chunks, completed);
+        REQUIRE(completed.size() == 1);
+        BuildLodChunk(chunks, {0, 0, 0}, 1, padded);
+        mesher.Mesh(padded, expected);
+        CHECK(completed[0].mesh.vertices == expected.vertices);
+    }
+}
+
+TEST_CASE("Applicationメッシュ生成統合テスト") {
+    SUBCASE("メインループ中に要求したチャンクのメッシュが回収される") {
+        ApplicationConfig config;
+        config.workerThreadCount = 1;
+        Application app(std::make_unique<MockWindow>(), config);
+        MakeTerrainChunk(app.GetChunkManager(), {0, 0, 0});
+        app.GetMeshingPipeline().Request({0, 0, 0});
+        
+        for (int frame = 0; frame < 1000 && app.FindChunkMesh({0, 0, 0}) == nullptr; ++frame) {
+            app.RunFrames(1);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        REQUIRE(app.FindChunkMesh({0, 0, 0}) != nullptr);
+        CHECK_FALSE(app.FindChunkMesh({0, 0, 0})->IsEmpty());
+    }
+    
+    SUBCASE("ブロック変更は同じフレーム内で該当チャンクと隣接チャンクのメッシュへ反映される") {
+        ApplicationConfig config;
+        config.workerThreadCount = 1;
+        Application app(std::make_unique<MockWindow>(), config);
+        MakeTerrainChunk(app.GetChunkManager(), {0, 0, 0});
+        MakeTerrainChunk(app.GetChunkManager(), {1, 0, 0});
+        app.GetMeshingPipeline().Request({0, 0, 0});
+        app.GetMeshingPipeline().Request({1, 0, 0});
+        for (int frame = 0; frame < 1000 && (app.FindChunkMesh({0, 0, 0}) == nullptr ||
+                                             app.FindChunkMesh({1, 0, 0}) == nullptr); ++frame) {
+            app.RunFrames(1);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        REQUIRE(app.FindChunkMesh({0, 0, 0}) != nullptr);
+        REQUIRE(app.FindChunkMesh({1, 0, 0}) != nullptr);
+        
+        // チャンク(0,0,0)の+X境界のブロックを壊すと、隣接チャンクの-X面が露出する
+        CHECK(app.SetBlock(15, 1, 7, Blocks::Air));
+        CHECK_FALSE(app.SetBlock(15, 1, 7, Blocks::Air));
+        CHECK(app.GetIncrementalRemeshCount() == 2);
+        
+        GreedyMesher mesher;
+        PaddedChunk padded;
+        ChunkMesh expected;
+        for (const ChunkCoord coord : {ChunkCoord{0, 0, 0}, ChunkCoord{1, 0, 0}}) {
+            padded.Build(app.GetChunkManager().GetNeighborhood(coord));
+            mesher.Mesh(padded, expected);
+            CHECK(app.FindChunkMesh(coord)->vertices == expected.vertices);
+        }
+    }
+    
+    SUBCASE("実行中の隣接チャンクの生成結果は境界の変更後に破棄され、差し替えたメッシュを上書きしない") {
+        ApplicationConfig config;
+        config.workerThreadCount = 1;
+        Application app(std::make_unique<MockWindow>(), config);
+        MakeTerrainChunk(app.GetChunkManager(), {0, 0, 0});
+        MakeTerrainChunk(app.GetChunkManager(), {1, 0, 0});
+        MeshingPipeline& pipeline = app.GetMeshingPipeline();
+        pipeline.Request({0, 0, 0});
+        pipeline.Request({1, 0, 0});
+        for (int frame = 0; frame < 1000 && (app.FindChunkMesh({0, 0, 0}) == nullptr ||
+                                             app.FindChunkMesh({1, 0, 0}) == nullptr); ++frame) {
+            app.RunFrames(1);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        REQUIRE(app.FindChunkMesh({1, 0, 0}) != nullptr);
+        
+        // 隣接チャンクの再生成を投入し、変更前の境界をスナップショットさせる
+        pipeline.Request({1, 0, 0});
+        app.RunFrames(1);
+        REQUIRE(pipeline.GetJobsInFlight() == 1);
+        const std::uint64_t discardedBefore = pipeline.GetDiscardedCount();
+        
+        // チャンク(0,0,0)の+X境界のブロックを壊す（チャンク(1,0,0)のメッシュはその場で差し替えられる）
+        CHECK(app.SetBlock(15, 1, 7, Blocks::Air));
+        for (int frame = 0; frame < 1000 && (pipeline.GetJobsInFlight() > 0 || pipeline.GetPendingCount() > 0);
+             ++frame) {
+            app.RunFrames(1);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        REQUIRE(pipeline.GetJobsInFlight() == 0);
+        CHECK(pipeline.GetDiscardedCount() > discardedBefore);
+        
+        GreedyMesher mesher;
+        PaddedChunk padded;
+        ChunkMesh expected;
+        padded.Build(app.GetChunkManager().GetNeighborhood({1, 0, 0}));
+        mesher.Mesh(padded, expected);
+        CHECK(app.FindChunkMesh({1, 0, 0})->vertices == expected.vertices);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
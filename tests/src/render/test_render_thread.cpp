@@ -0,0 +1,136 @@
+#include <doctest/doctest.h>
+#include "core/Application.hpp"
+#include "core/Exception.hpp"
+#include "mocks/MockWindow.hpp"
+#include "render/RenderCommandList.hpp"
+#include "render/RenderThread.hpp"
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 提示が遅いウィンドウ（描画側がボトルネックの状況を再現）
+class SlowPresentWindow : public MockWindow {
+public:
+    void SwapBuffers() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        MockWindow::SwapBuffers();
+    }
+};
+
+} // namespace
+
+TEST_CASE("RenderCommandListテスト") {
+    SUBCASE("記録したコマンドが順序通りに保持される") {
+        RenderCommandList list;
+        list.Reset(7, 0.25f);
+        list.SetViewport(0, 0, 640, 480);
+        list.Clear(0.1f, 0.2f, 0.3f, 1.0f, false);
+        
+        CHECK(list.GetFrameIndex() == 7);
+        CHECK(list.GetAlpha() == doctest::Approx(0.25f));
+        REQUIRE(list.GetCommands().size() == 2);
+        CHECK(list.GetCommands()[0].type == RenderCommandType::SetViewport);
+        CHECK(list.GetCommands()[0].viewport[2] == 640);
+        CHECK(list.GetCommands()[1].type == RenderCommandType::Clear);
+        CHECK(list.GetCommands()[1].clearDepth == false);
+    }
+    
+    SUBCASE("Resetでコマンドは消えるが容量は保持される") {
+        RenderCommandList list;
+        for (int i = 0; i < 300; ++i) {
+            list.Clear(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        const auto capacity = list.GetCommands().capacity();
+        list.Reset(1, 0.0f);
+        CHECK(list.GetCommands().empty());
+        CHECK(list.GetCommands().capacity() == capacity);
+    }
+}
+
+TEST_CASE("RenderThreadテスト") {
+    SUBCASE("提出したフレームが全て提示される") {
+        MockWindow window;
+        {
+            RenderThread renderThread(window, 3);
+            CHECK(renderThread.GetBufferCount() == 3);
+            for (std::uint64_t frame = 0; frame < 20; ++frame) {
+                RenderCommandList& list = renderThread.BeginFrame(frame, 0.0f);
+                list.Clear(0.0f, 0.0f, 0.0f, 1.0f);
+                renderThread.SubmitFrame();
+            }
+            renderThread.Flush();
+            CHECK(renderThread.GetPresentedFrameCount() == 20);
+        }
+        CHECK(window.GetSwapBuffersCallCount() == 20);
+    }
+    
+    SUBCASE("破棄時に未提示のフレームも提示してから停止する") {
+        MockWindow window;
+        {
+            RenderThread renderThread(window, 2);
+            for (std::uint64_t frame = 0; frame < 5; ++frame) {
+                renderThread.BeginFrame(frame, 0.0f);
+                renderThread.SubmitFrame();
+            }
+        }
+        CHECK(window.GetSwapBuffersCallCount() == 5);
+    }
+    
+    SUBCASE("提示が遅い場合はBeginFrameが空きリストを待つ") {
+        SlowPresentWindow window;
+        RenderThread renderThread(window, 2);
+        for (std::uint64_t frame = 0; frame < 10; ++frame) {
+            renderThread.BeginFrame(frame, 0.0f);
+            renderThread.SubmitFrame();
+            // 先行できるのはバッファ数分まで
+            CHECK(frame + 1 - renderThread.GetPresentedFrameCount() <= renderThread.GetBufferCount());
+        }
+        renderThread.Flush();
+        CHECK(renderThread.GetPresentedFrameCount() == 10);
+        CHECK(renderThread.GetStallSeconds() > 0.0);
+    }
+    
+    SUBCASE("範囲外のコマンドリスト数は例外") {
+        MockWindow window;
+        CHECK_THROWS_AS(RenderThread(window, 1), InitializationException);
+        CHECK_THROWS_AS(RenderThread(window, 4), InitializationException);
+    }
+}
+
+TEST_CASE("Application描画スレッド設定テスト") {
+    SUBCASE("描画スレッド有効時もRunFrames終了時に全フレーム提示済み") {
+        auto window = std::make_unique<MockWindow>();
+        MockWindow* mock = window.get();
+        
+        ApplicationConfig config;
+        config.threadedRendering = true;
+        config.renderBufferCount = 2;
+        Application app(std::move(window), config);
+        REQUIRE(app.GetRenderThread() != nullptr);
+        
+        app.RunFrames(30);
+        CHECK(app.GetRenderThread()->GetPresentedFrameCount() == 30);
+        CHECK(mock->GetSwapBuffersCallCount() == 30);
+    }
+    
+    SUBCASE("描画スレッド無効時はメインスレッドで提示") {
+        auto window = std::make_unique<MockWindow>();
+        MockWindow* mock = window.get();
+        
+        ApplicationConfig config;
+        config.threadedRendering = false;
+        Application app(std::move(window), config);
+        CHECK(app.GetRenderThread() == nullptr);
+        
+        app.RunFrames(10);
+        CHECK(mock->GetSwapBuffersCallCount() == 10);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <doctest/doctest.h>
+#include "render/ChunkMesh.hpp"
+#include "render/VoxelVertex.hpp"
+#include <array>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("PackedVoxelVertexテスト") {
+    SUBCASE("全フィールドを最大値まで往復できる") {
+        const PackedVoxelVertex vertex = PackedVoxelVertex::Pack(16, 9, 1, 5, 2, 1, 0, 16, 3, 0xFFFF);
+        CHECK(vertex.GetX() == 16);
+        CHECK(vertex.GetY() == 9);
+        CHECK(vertex.GetZ() == 1);
+        CHECK(vertex.GetNormal() == 5);
+        CHECK(vertex.GetAmbientOcclusion() == 2);
+        CHECK(vertex.GetCornerU() == 1);
+        CHECK(vertex.GetCornerV() == 0);
+        CHECK(vertex.GetWidth() == 16);
+        CHECK(vertex.GetHeight() == 3);
+        CHECK(vertex.GetTextureLayer() == 0xFFFF);
+        CHECK(sizeof(PackedVoxelVertex) == 8);
+    }
+    
+    SUBCASE("四角形の4頂点は外側から見て反時計回り") {
+        for (int faceIndex = 0; faceIndex < kBlockFaceCount; ++faceIndex) {
+            MeshQuad quad;
+            quad.x = 2;
+            quad.y = 3;
+            quad.z = 4;
+            quad.width = 5;
+            quad.height = 7;
+            quad.face = static_cast<BlockFace>(faceIndex);
+            quad.textureLayer = 11;
+            
+            std::vector<PackedVoxelVertex> vertices;
+            AppendQuadVertices(quad, vertices);
+            REQUIRE(vertices.size() == kVerticesPerQuad);
+            
+            // 最初の三角形の法線が面の向きと一致する
+            const auto position = [&](int i) {
+                return std::array<int, 3>{static_cast<int>(vertices[i].GetX()), static_cast<int>(vertices[i].GetY()),
+                                          static_cast<int>(vertices[i].GetZ())};
+            };
+            const auto p0 = position(0);
+            const auto p1 = position(1);
+            const auto p2 = position(2);
+            const int a[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+            const int b[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+            const int cross[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+            const int axis = GetFaceAxis(quad.face);
+            CHECK(cross[axis] * (IsPositiveFace(quad.face) ? 1 : -1) > 0);
+            CHECK(cross[(axis + 1) % 3] == 0);
+            CHECK(cross[(axis + 2) % 3] == 0);
+            
+            // 正方向の面はブロックの外側の境界（+1）に置かれる
+            CHECK(p0[axis] == (axis == 0 ? 2 : axis == 1 ? 3 : 4) + (IsPositiveFace(quad.face) ? 1 : 0));
+            
+            // 4頂点から元の四角形を復元できる
+            CHECK(DecodeQuad(vertices) == quad);
+        }
+    }
+    
+    SUBCASE("暗い角を通る対角線にならないよう開始頂点をずらす") {
+        MeshQuad quad;
+        quad.face = BlockFace::PositiveY;
+        quad.textureLayer = 3;
+        // 角(0, 0)だけが最も暗い
+        quad.ambientOcclusion = static_cast<std::uint8_t>(kNoAmbientOcclusion & ~(0x3u << GetAmbientOcclusionShift(0, 0)));
+        
+        std::vector<PackedVoxelVertex> vertices;
+        AppendQuadVertices(quad, vertices);
+        REQUIRE(vertices.size() == kVerticesPerQuad);
+        // インデックス 0,1,2 / 0,2,3 の対角線（頂点0-2）は暗い角を含まない
+        CHECK(vertices[0].GetAmbientOcclusion() == 3);
+        CHECK(vertices[2].GetAmbientOcclusion() == 3);
+        CHECK((vertices[1].GetAmbientOcclusion() == 0 || vertices[3].GetAmbientOcclusion() == 0));
+        CHECK(DecodeQuad(vertices) == quad);
+        
+        // 遮蔽が無ければ最小角から始まる
+        quad.ambientOcclusion = kNoAmbientOcclusion;
+        vertices.clear();
+        AppendQuadVertices(quad, vertices);
+        CHECK(vertices[0].GetCornerU() == 0);
+        CHECK(vertices[0].GetCornerV() == 0);
+    }
+    
+    SUBCASE("チャンク端の面は座標16まで表現できる") {
+        MeshQuad quad;
+        quad.x = 15;
+        quad.y = 0;
+        quad.z = 0;
+        quad.width = kChunkSize;
+        quad.height = kChunkSize;
+        quad.face = BlockFace::PositiveX;
+        
+        ChunkMesh mesh;
+        mesh.AddQuad(quad);
+        CHECK(mesh.GetQuadCount() == 1);
+        CHECK(mesh.GetQuad(0) == quad);
+        for (const PackedVoxelVertex& vertex : mesh.vertices) {
+            CHECK(vertex.GetX() == 16);
+        }
+        CHECK(mesh.CountFaces() == kChunkSize * kChunkSize);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <doctest/doctest.h>
+#include "world/BlockRegistry.hpp"
+#include <unordered_set>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("ブロック定義表テスト") {
+    SUBCASE("表は定義と一致する") {
+        for (const BlockDefinition& definition : kBlockDefinitions) {
+            INFO(definition.name);
+            CHECK(IsRegisteredBlock(definition.id));
+            CHECK(GetBlockName(definition.id) == definition.name);
+            CHECK(IsCubeBlock(definition.id) == definition.cube);
+            CHECK(IsFaceOccludingBlock(definition.id) == (definition.cube && definition.opaque));
+            CHECK(IsOpaqueBlock(definition.id) == definition.opaque);
+            CHECK(IsSolidBlock(definition.id) == definition.solid);
+            CHECK(IsTransparentBlock(definition.id) == definition.transparent);
+            CHECK(GetBlockLightEmission(definition.id) == definition.lightEmission);
+            CHECK(GetBlockHardness(definition.id) == definition.hardness);
+            for (int face = 0; face < kBlockFaceCount; ++face) {
+                CHECK(GetBlockTextureLayer(definition.id, static_cast<BlockFace>(face)) == definition.textures[face]);
+            }
+        }
+    }
+    
+    SUBCASE("代表的なブロックの性質") {
+        CHECK_FALSE(IsCubeBlock(Blocks::Air));
+        CHECK_FALSE(IsSolidBlock(Blocks::Air));
+        CHECK(IsOpaqueBlock(Blocks::Stone));
+        // ガラス・葉は光を通す立方体
+        CHECK(IsCubeBlock(Blocks::Glass));
+        CHECK_FALSE(IsOpaqueBlock(Blocks::Glass));
+        CHECK(IsTransparentBlock(Blocks::Glass));
+        CHECK(IsTransparentBlock(Blocks::Leaves));
+        // 隣接する面を隠すのは不透明な立方体のみ
+        CHECK(IsFaceOccludingBlock(Blocks::Stone));
+        CHECK_FALSE(IsFaceOccludingBlock(Blocks::Glass));
+        CHECK_FALSE(IsFaceOccludingBlock(Blocks::Torch));
+        // 松明は発光し、衝突判定を持たない
+        CHECK(GetBlockLightEmission(Blocks::Torch) == 14);
+        CHECK_FALSE(IsSolidBlock(Blocks::Torch));
+        CHECK(GetBlockHardness(Blocks::Stone) > GetBlockHardness(Blocks::Dirt));
+    }
+    
+    SUBCASE("面ごとのテクスチャ") {
+        CHECK(GetBlockTextureLayer(Blocks::Grass, BlockFace::PositiveY) == BlockTextures::GrassTop);
+        CHECK(GetBlockTextureLayer(Blocks::Grass, BlockFace::NegativeY) == BlockTextures::Dirt);
+        CHECK(GetBlockTextureLayer(Blocks::Grass, BlockFace::PositiveX) == BlockTextures::GrassSide);
+        CHECK(GetBlockTextureLayer(Blocks::Grass, BlockFace::NegativeZ) == BlockTextures::GrassSide);
+        CHECK(GetBlockTextureLayer(Blocks::Wood, BlockFace::NegativeY) == BlockTextures::WoodTop);
+        CHECK(GetBlockTextureLayer(Blocks::Stone, BlockFace::NegativeX) == BlockTextures::Stone);
+    }
+    
+    SUBCASE("未登録のIDは欠落テクスチャの立方体") {
+        for (const BlockId block : {static_cast<BlockId>(kBlockTypeCount), static_cast<BlockId>(1000), BlockId{0xFFFF}}) {
+            CHECK_FALSE(IsRegisteredBlock(block));
+            CHECK(IsCubeBlock(block));
+            CHECK(IsOpaqueBlock(block));
+            CHECK(GetBlockLightEmission(block) == 0);
+            CHECK(GetBlockTextureLayer(block, BlockFace::PositiveY) == BlockTextures::Missing);
+            CHECK(GetBlockName(block) == "unknown");
+        }
+    }
+    
+    SUBCASE("各ブロックの名前は一意") {
+        std::unordered_set<std::string_view> names;
+        for (const BlockDefinition& definition : kBlockDefinitions) {
+            CHECK(names.insert(definition.name).second);
+        }
+        CHECK(names.size() == kBlockTypeCount);
+    }
+}
+
+TEST_CASE("ブロック定義の検証はコンパイル時に評価できる") {
+    // 不正な定義を検証関数が拒否する（static_assertで使う関数と同じ）
+    constexpr BlockDefinition unordered[] = {
+        {Blocks::Air, "air"},
+        {Blocks::Dirt, "dirt", true, true, true},
+    };
+    static_assert(!BlockRegistryValidation::HasSequentialIds(unordered));
+    
+    constexpr BlockDefinition opaqueNonCube{Blocks::Stone, "stone", false, true, true};
+    static_assert(!BlockRegistryValidation::HasConsistentFlags(opaqueNonCube));
+    constexpr BlockDefinition transparentOpaque{Blocks::Glass, "glass", true, true, true, true};
+    static_assert(!BlockRegistryValidation::HasConsistentFlags(transparentOpaque));
+    constexpr BlockDefinition tooBright{Blocks::Torch, "torch", true, false, false, false, 16};
+    static_assert(!BlockRegistryValidation::HasConsistentFlags(tooBright));
+    
+    constexpr BlockDefinition duplicated[] = {
+        {Blocks::Air, "air"},
+        {Blocks::Stone, "air", true, true, true},
+    };
+    static_assert(!BlockRegistryValidation::HasUniqueNames(duplicated));
+    constexpr BlockDefinition solidAir[] = {
+        {Blocks::Air, "air", false, false, true},
+    };
+    static_assert(!BlockRegistryValidation::IsAirFirst(solidAir));
+    
+    static_assert(IsOpaqueBlock(Blocks::Dirt));
+    CHECK(BlockRegistryValidation::HasSequentialIds(kBlockDefinitions));
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
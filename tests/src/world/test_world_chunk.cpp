@@ -0,0 +1,138 @@
+#include <doctest/doctest.h>
+#include "world/Chunk.hpp"
+#include <array>
+#include <random>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("Chunkパレット圧縮テスト") {
+    SUBCASE("一様なチャンクは0ビットで格納される") {
+        Chunk chunk(Blocks::Stone);
+        CHECK(chunk.IsUniform());
+        CHECK(chunk.GetBitsPerBlock() == 0);
+        CHECK(chunk.GetPaletteSize() == 1);
+        CHECK(chunk.Get(0, 0, 0) == Blocks::Stone);
+        CHECK(chunk.Get(15, 15, 15) == Blocks::Stone);
+        CHECK_FALSE(chunk.IsEmpty());
+        CHECK(Chunk().IsEmpty());
+        CHECK(chunk.GetMemoryUsage() < 16);
+    }
+    
+    SUBCASE("書き込みでパレットとビット幅が拡大する") {
+        Chunk chunk;
+        CHECK(chunk.Set(1, 2, 3, Blocks::Stone));
+        CHECK_FALSE(chunk.Set(1, 2, 3, Blocks::Stone));
+        CHECK(chunk.GetBitsPerBlock() == 1);
+        CHECK(chunk.GetPaletteSize() == 2);
+        CHECK(chunk.Get(1, 2, 3) == Blocks::Stone);
+        CHECK(chunk.Get(0, 0, 0) == Blocks::Air);
+        
+        chunk.Set(4, 5, 6, Blocks::Dirt);
+        CHECK(chunk.GetBitsPerBlock() == 2);
+        for (BlockId id = 10; id < 30; ++id) {
+            chunk.Set(id - 10, 0, 0, id);
+        }
+        CHECK(chunk.GetBitsPerBlock() == 8);
+        CHECK(chunk.Get(1, 2, 3) == Blocks::Stone);
+        CHECK(chunk.Get(4, 5, 6) == Blocks::Dirt);
+        CHECK(chunk.Get(5, 0, 0) == 15);
+    }
+    
+    SUBCASE("使用種類が減るとパレットとビット幅が縮小する") {
+        Chunk chunk;
+        for (int i = 0; i < 10; ++i) {
+            chunk.Set(i, 0, 0, static_cast<BlockId>(100 + i));
+        }
+        CHECK(chunk.GetBitsPerBlock() == 4);
+        
+        for (int i = 0; i < 10; ++i) {
+            chunk.Set(i, 0, 0, Blocks::Air);
+        }
+        CHECK(chunk.IsUniform());
+        CHECK(chunk.GetPaletteSize() == 1);
+        CHECK(chunk.GetUniformBlock() == Blocks::Air);
+    }
+    
+    SUBCASE("全ブロック異なるIDでは16ビット幅になる") {
+        Chunk chunk;
+        for (int i = 0; i < kChunkVolume; ++i) {
+            chunk.SetByIndex(i, static_cast<BlockId>(i + 1));
+        }
+        CHECK(chunk.GetBitsPerBlock() == 16);
+        CHECK(chunk.GetPaletteSize() == static_cast<std::size_t>(kChunkVolume));
+        std::vector<BlockId> expected(kChunkVolume);
+        std::vector<BlockId> unpacked(kChunkVolume);
+        for (int i = 0; i < kChunkVolume; ++i) {
+            expected[i] = static_cast<BlockId>(i + 1);
+        }
+        chunk.Unpack(unpacked);
+        CHECK(unpacked == expected);
+        CHECK(chunk.GetByIndex(1234) == 1235);
+    }
+    
+    SUBCASE("ランダムな書き込みが非圧縮配列と一致する") {
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<int> position(0, kChunkVolume - 1);
+        std::uniform_int_distribution<int> block(0, 40);
+        
+        Chunk chunk;
+        std::vector<BlockId> reference(kChunkVolume, Blocks::Air);
+        int changeMismatches = 0;
+        for (int i = 0; i < 20000; ++i) {
+            const int index = position(rng);
+            const BlockId id = static_cast<BlockId>(block(rng));
+            if (chunk.SetByIndex(index, id) != (reference[index] != id)) {
+                ++changeMismatches;
+            }
+            reference[index] = id;
+        }
+        CHECK(changeMismatches == 0);
+        // 全ブロックを3種類以下に書き換えて縮小経路も通す
+        for (int index = 0; index < kChunkVolume; ++index) {
+            const BlockId id = static_cast<BlockId>(block(rng) % 3);
+            chunk.SetByIndex(index, id);
+            reference[index] = id;
+        }
+        
+        std::vector<BlockId> unpacked(kChunkVolume);
+        chunk.Unpack(unpacked);
+        CHECK(unpacked == reference);
+        CHECK(chunk.GetPaletteSize() <= 3);
+        CHECK(chunk.GetBitsPerBlock() <= 4);
+    }
+    
+    SUBCASE("Assignは最小のビット幅で格納しUnpackで復元できる") {
+        std::vector<BlockId> blocks(kChunkVolume, Blocks::Stone);
+        for (int y = 8; y < kChunkSize; ++y) {
+            for (int z = 0; z < kChunkSize; ++z) {
+                for (int x = 0; x < kChunkSize; ++x) {
+                    blocks[ToChunkIndex(x, y, z)] = y == 8 ? Blocks::Grass : Blocks::Air;
+                }
+            }
+        }
+        
+        Chunk chunk;
+        chunk.Assign(blocks);
+        CHECK(chunk.GetBitsPerBlock() == 2);
+        CHECK(chunk.GetPaletteSize() == 3);
+        CHECK(chunk.Get(3, 8, 4) == Blocks::Grass);
+        CHECK(chunk.Get(3, 2, 4) == Blocks::Stone);
+        
+        std::vector<BlockId> unpacked(kChunkVolume);
+        chunk.Unpack(unpacked);
+        CHECK(unpacked == blocks);
+        
+        // 非圧縮16ビット（8KiB）に対して1/8以下
+        CHECK(chunk.GetMemoryUsage() <= kChunkVolume * sizeof(BlockId) / 8 + 64);
+        
+        std::vector<BlockId> uniform(kChunkVolume, Blocks::Dirt);
+        chunk.Assign(uniform);
+        CHECK(chunk.IsUniform());
+        CHECK(chunk.GetUniformBlock() == Blocks::Dirt);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
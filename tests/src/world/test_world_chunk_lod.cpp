@@ -0,0 +1,180 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "render/GreedyMesher.hpp"
+#include "world/BlockRegistry.hpp"
+#include "world/ChunkLod.hpp"
+#include "world/ChunkManager.hpp"
+#include <array>
+#include <random>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+// 起伏のある地形（草の表面・石の内部）で領域を埋める
+void MakeTerrain(ChunkManager& chunks, const ChunkCoord& minChunk, const ChunkCoord& maxChunk) {
+    for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+        for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                chunks.GetOrCreate({cx, cy, cz});
+            }
+        }
+    }
+    for (int z = minChunk.z * kChunkSize; z < (maxChunk.z + 1) * kChunkSize; ++z) {
+        for (int x = minChunk.x * kChunkSize; x < (maxChunk.x + 1) * kChunkSize; ++x) {
+            const int height = 20 + (x * 7 + z * 3) % 9 + ((x / 5 + z / 7) % 4) * 3;
+            for (int y = minChunk.y * kChunkSize; y < height; ++y) {
+                chunks.SetBlock(x, y, z, y + 1 == height ? Blocks::Grass : Blocks::Stone);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("LOD座標変換テスト") {
+    CHECK(ToLodRegion({5, -1, -8}, 1) == ChunkCoord{2, -1, -4});
+    CHECK(ToLodRegion({5, -1, -9}, 3) == ChunkCoord{0, -1, -2});
+    CHECK(GetLodRegionOrigin({-1, 2, 0}, 2) == ChunkCoord{-4, 8, 0});
+    CHECK(GetLodScale(3) == 8);
+}
+
+TEST_CASE("チャンク縮小テスト") {
+    std::array<BlockId, kChunkVolume> cells{};
+    
+    SUBCASE("一様チャンクは一様に縮小される") {
+        Chunk chunk;
+        chunk.Fill(Blocks::Stone);
+        DownsampleChunk(chunk, 2, cells);
+        for (int i = 0; i < 64; ++i) {
+            CHECK(cells[i] == Blocks::Stone);
+        }
+    }
+    
+    SUBCASE("1ブロックでも不透明なら不透明、種別は上側の層を優先") {
+        Chunk chunk;
+        chunk.Set(1, 0, 0, Blocks::Dirt);
+        chunk.Set(0, 0, 1, Blocks::Dirt);
+        chunk.Set(1, 1, 1, Blocks::Grass);
+        chunk.Set(15, 15, 15, Blocks::Sand);
+        DownsampleChunk(chunk, 1, cells);
+        CHECK(cells[0] == Blocks::Grass);
+        CHECK(cells[1] == Blocks::Air);
+        CHECK(cells[7 + (7 + 7 * 8) * 8] == Blocks::Sand);
+        
+        DownsampleChunk(chunk, 3, cells);
+        CHECK(cells[0] == Blocks::Grass);
+        CHECK(cells[7] == Blocks::Sand);
+        CHECK(cells[1] == Blocks::Air);
+    }
+    
+    SUBCASE("粗いレベルの不透明セルは細かいレベルの不透明セルを包含する") {
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> block(0, 12);
+        Chunk chunk;
+        for (int i = 0; i < kChunkVolume; ++i) {
+            const int value = block(rng);
+            chunk.SetByIndex(i, value < 5 ? Blocks::Air : static_cast<BlockId>(value - 4));
+        }
+        
+        std::array<BlockId, kChunkVolume> fine{};
+        chunk.Unpack(fine);
+        int violations = 0;
+        for (int level = 1; level <= kMaxLodLevel; ++level) {
+            const int size = kChunkSize >> level;
+            DownsampleChunk(chunk, level, cells);
+            const int fineSize = size * 2;
+            for (int y = 0; y < fineSize; ++y) {
+                for (int z = 0; z < fineSize; ++z) {
+                    for (int x = 0; x < fineSize; ++x) {
+                        const BlockId child = fine[x + (z + y * fineSize) * fineSize];
+                        const BlockId parent = cells[x / 2 + (z / 2 + (y / 2) * size) * size];
+                        violations += IsCubeBlock(child) && !IsCubeBlock(parent) ? 1 : 0;
+                    }
+                }
+            }
+            fine = cells;
+        }
+        CHECK(violations == 0);
+    }
+    
+    SUBCASE("範囲外のレベルは例外") {
+        Chunk chunk;
+        CHECK_THROWS_AS(DownsampleChunk(chunk, kMaxLodLevel + 1, cells), BoxelGameException);
+    }
+}
+
+TEST_CASE("LOD領域構築テスト") {
+    ChunkManager chunks;
+    
+    SUBCASE("領域内のチャンクを縮小して配置し、境界は空気") {
+        chunks.GetOrCreate({1, 0, 1}, Blocks::Stone);
+        chunks.GetOrCreate({2, 0, 0}, Blocks::Stone);  // 領域外
+        PaddedChunk padded;
+        BuildLodChunk(chunks, {0, 0, 0}, 1, padded);
+        CHECK(padded.Get(8, 0, 8) == Blocks::Stone);
+        CHECK(padded.Get(15, 7, 15) == Blocks::Stone);
+        CHECK(padded.Get(7, 0, 8) == Blocks::Air);
+        CHECK(padded.Get(8, 8, 8) == Blocks::Air);
+        CHECK(padded.Get(16, 0, 8) == Blocks::Air);
+    }
+    
+    SUBCASE("版は領域内の変更・ロード・アンロードで変わる") {
+        CHECK(ComputeLodRevision(chunks, {0, 0, 0}, 2) == 0);
+        chunks.GetOrCreate({1, 1, 1});
+        const std::uint64_t loaded = ComputeLodRevision(chunks, {0, 0, 0}, 2);
+        CHECK(loaded != 0);
+        chunks.SetBlock(16, 16, 16, Blocks::Dirt);
+        const std::uint64_t edited = ComputeLodRevision(chunks, {0, 0, 0}, 2);
+        CHECK(edited != loaded);
+        chunks.SetBlock(16 * 4, 16, 16, Blocks::Dirt);  // 領域外
+        CHECK(ComputeLodRevision(chunks, {0, 0, 0}, 2) == edited);
+        chunks.Remove({1, 1, 1});
+        CHECK(ComputeLodRevision(chunks, {0, 0, 0}, 2) == 0);
+    }
+    
+    SUBCASE("アンロードと別チャンクの変更が重なっても版が変わる") {
+        // 版の総和では (a + 1) + (c + 1) と (a + c + 1) + 1 が一致してしまう組み合わせ
+        Chunk& kept = chunks.GetOrCreate({0, 0, 0});
+        const Chunk& unloaded = chunks.GetOrCreate({1, 0, 0});
+        const std::uint64_t target = kept.GetRevision() + unloaded.GetRevision() + 1;
+        const std::uint64_t before = ComputeLodRevision(chunks, {0, 0, 0}, 1);
+        chunks.Remove({1, 0, 0});
+        while (kept.GetRevision() < target) {
+            kept.Set(0, 0, 0, kept.Get(0, 0, 0) == Blocks::Dirt ? Blocks::Stone : Blocks::Dirt);
+        }
+        CHECK(ComputeLodRevision(chunks, {0, 0, 0}, 1) != before);
+        CHECK(ComputeLodRevision(chunks, {0, 0, 0}, 0) != 0);
+    }
+    
+    SUBCASE("遠方の地形は粗いレベルほど少ない四角形で描ける") {
+        MakeTerrain(chunks, {0, 0, 0}, {7, 3, 7});
+        GreedyMesher mesher;
+        PaddedChunk padded;
+        ChunkMesh mesh;
+        
+        std::size_t quads[kLodLevelCount] = {};
+        for (int level = 0; level <= kMaxLodLevel; ++level) {
+            const int scale = GetLodScale(level);
+            const int regions = 8 / scale;
+            const int regionsY = (4 + scale - 1) / scale;
+            for (int y = 0; y < regionsY; ++y) {
+                for (int z = 0; z < regions; ++z) {
+                    for (int x = 0; x < regions; ++x) {
+                        BuildLodChunk(chunks, {x, y, z}, level, padded);
+                        mesher.Mesh(padded, mesh);
+                        quads[level] += mesh.GetQuadCount();
+                    }
+                }
+            }
+            MESSAGE("LOD" << level << ": " << quads[level] << " quads");
+        }
+        CHECK(quads[1] * 2 < quads[0]);
+        CHECK(quads[2] * 2 < quads[1]);
+        CHECK(quads[3] < quads[2]);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
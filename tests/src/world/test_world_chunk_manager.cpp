@@ -0,0 +1,158 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "world/ChunkManager.hpp"
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+
+namespace BoxelGame {
+namespace Test {
+
+TEST_CASE("ChunkCoordテスト") {
+    SUBCASE("負の座標を含めてキーへ往復変換できる") {
+        const ChunkCoord coords[] = {{0, 0, 0}, {-1, -1, -1}, {123, -456, 789}, {kChunkCoordMax, kChunkCoordMin, 0}};
+        for (const ChunkCoord& coord : coords) {
+            CHECK(UnpackChunkCoord(PackChunkCoord(coord)) == coord);
+        }
+        CHECK(PackChunkCoord({1, 0, 0}) != PackChunkCoord({0, 1, 0}));
+    }
+    
+    SUBCASE("ブロック座標は床関数でチャンク座標へ変換される") {
+        CHECK(BlockToChunkCoord(15, 16, -1) == ChunkCoord{0, 1, -1});
+        CHECK(BlockToChunk(-16) == -1);
+        CHECK(BlockToChunk(-17) == -2);
+        CHECK(BlockToLocal(-17) == 15);
+    }
+}
+
+TEST_CASE("ChunkManagerテスト") {
+    SUBCASE("登録・検索・削除") {
+        ChunkManager manager(16);
+        Chunk& chunk = manager.GetOrCreate({1, 2, 3}, Blocks::Stone);
+        CHECK(manager.GetChunkCount() == 1);
+        CHECK(manager.Find({1, 2, 3}) == &chunk);
+        CHECK(manager.Find({3, 2, 1}) == nullptr);
+        CHECK(&manager.GetOrCreate({1, 2, 3}) == &chunk);
+        
+        auto removed = manager.Remove({1, 2, 3});
+        CHECK(removed.get() == &chunk);
+        CHECK(manager.GetChunkCount() == 0);
+        CHECK(manager.Find({1, 2, 3}) == nullptr);
+        CHECK(manager.Remove({1, 2, 3}) == nullptr);
+    }
+    
+    SUBCASE("再ハッシュ後もチャンクのアドレスは変わらない") {
+        ChunkManager manager(16);
+        Chunk* first = &manager.GetOrCreate({0, 0, 0});
+        for (int x = 0; x < 20; ++x) {
+            for (int z = 0; z < 20; ++z) {
+                manager.GetOrCreate({x, 1, z});
+            }
+        }
+        CHECK(manager.GetChunkCount() == 401);
+        CHECK(manager.GetCapacity() >= 802);
+        CHECK(manager.Find({0, 0, 0}) == first);
+    }
+    
+    SUBCASE("ランダムな追加・削除がstd::mapと一致する") {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> coordinate(-8, 8);
+        ChunkManager manager(16);
+        std::map<std::tuple<int, int, int>, Chunk*> reference;
+        
+        int mismatches = 0;
+        for (int i = 0; i < 5000; ++i) {
+            const ChunkCoord coord{coordinate(rng), coordinate(rng), coordinate(rng)};
+            const auto key = std::make_tuple(coord.x, coord.y, coord.z);
+            if (rng() % 3 == 0) {
+                auto removed = manager.Remove(coord);
+                const auto it = reference.find(key);
+                if ((it == reference.end()) != (removed == nullptr) ||
+                    (it != reference.end() && it->second != removed.get())) {
+                    ++mismatches;
+                }
+                if (it != reference.end()) {
+                    reference.erase(it);
+                }
+            } else {
+                reference[key] = &manager.GetOrCreate(coord);
+            }
+        }
+        CHECK(mismatches == 0);
+        CHECK(manager.GetChunkCount() == reference.size());
+        
+        for (const auto& [key, chunk] : reference) {
+            const auto [x, y, z] = key;
+            if (manager.Find({x, y, z}) != chunk) {
+                ++mismatches;
+            }
+        }
+        std::size_t visited = 0;
+        manager.ForEach([&](const ChunkCoord& coord, const Chunk& chunk) {
+            ++visited;
+            const auto it = reference.find(std::make_tuple(coord.x, coord.y, coord.z));
+            if (it == reference.end() || it->second != &chunk) {
+                ++mismatches;
+            }
+        });
+        CHECK(mismatches == 0);
+        CHECK(visited == reference.size());
+    }
+    
+    SUBCASE("ワールド座標のブロックアクセス") {
+        ChunkManager manager;
+        manager.GetOrCreate({-1, 0, 0});
+        CHECK(manager.SetBlock(-1, 5, 3, Blocks::Dirt));
+        CHECK(manager.GetBlock(-1, 5, 3) == Blocks::Dirt);
+        CHECK(manager.Find({-1, 0, 0})->Get(15, 5, 3) == Blocks::Dirt);
+        
+        // 未ロードのチャンクは空気、書き込みは無視
+        CHECK(manager.GetBlock(100, 5, 3) == Blocks::Air);
+        CHECK_FALSE(manager.SetBlock(100, 5, 3, Blocks::Stone));
+    }
+    
+    SUBCASE("21ビットを超える座標は詰めたキーが重なっても別のチャンクを返さない") {
+        ChunkManager manager;
+        Chunk& origin = manager.GetOrCreate({0, 0, 0}, Blocks::Stone);
+        const ChunkCoord aliased{1 << kChunkCoordBits, 0, 0};
+        REQUIRE(PackChunkCoord(aliased) == PackChunkCoord({0, 0, 0}));
+        CHECK_FALSE(IsValidChunkCoord(aliased));
+        CHECK(manager.Find(aliased) == nullptr);
+        CHECK_FALSE(manager.Contains(aliased));
+        CHECK(manager.Remove(aliased) == nullptr);
+        CHECK(manager.Find({0, 0, 0}) == &origin);
+        CHECK_THROWS_AS(manager.GetOrCreate(aliased), BoxelGameException);
+        
+        const int blockX = (1 << kChunkCoordBits) * kChunkSize;
+        CHECK(manager.GetBlock(blockX, 0, 0) == Blocks::Air);
+        CHECK_FALSE(manager.SetBlock(blockX, 0, 0, Blocks::Dirt));
+        CHECK(origin.Get(0, 0, 0) == Blocks::Stone);
+    }
+}
+
+TEST_CASE("ChunkNeighborhoodテスト") {
+    SUBCASE("境界をまたぐブロックを近傍チャンクから取得する") {
+        ChunkManager manager;
+        manager.GetOrCreate({0, 0, 0});
+        manager.GetOrCreate({1, 0, 0}, Blocks::Stone);
+        manager.GetOrCreate({0, -1, 0}, Blocks::Dirt);
+        manager.GetOrCreate({-1, 1, -1}).Set(15, 0, 15, Blocks::Glass);
+        
+        const ChunkNeighborhood neighborhood = manager.GetNeighborhood({0, 0, 0});
+        CHECK(neighborhood.GetCenter() == manager.Find({0, 0, 0}));
+        CHECK(neighborhood.GetChunk(1, 0, 0) == manager.Find({1, 0, 0}));
+        CHECK(neighborhood.GetChunk(0, 1, 0) == nullptr);
+        
+        CHECK(neighborhood.GetBlock(0, 0, 0) == Blocks::Air);
+        CHECK(neighborhood.GetBlock(16, 3, 3) == Blocks::Stone);
+        CHECK(neighborhood.GetBlock(3, -1, 3) == Blocks::Dirt);
+        CHECK(neighborhood.GetBlock(-1, 16, -1) == Blocks::Glass);
+        // 未ロードの近傍は空気
+        CHECK(neighborhood.GetBlock(3, 16, 3) == Blocks::Air);
+        CHECK(neighborhood.GetBlock(-16, 0, 0) == Blocks::Air);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
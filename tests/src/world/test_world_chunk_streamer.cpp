@@ -0,0 +1,200 @@
+#include <doctest/doctest.h>
+#include "world/ChunkStreamer.hpp"
+#include "core/Application.hpp"
+#include "core/Exception.hpp"
+#include "mocks/MockWindow.hpp"
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+ChunkStreamingConfig MakeSmallConfig() {
+    ChunkStreamingConfig config;
+    config.spawnChunkX = 3;
+    config.spawnChunkZ = -2;
+    config.viewDistance = 2;
+    config.firstFrameRadius = 1;
+    config.minChunkY = 2;
+    config.maxChunkY = 5;
+    config.maxJobsInFlight = 4;
+    return config;
+}
+
+} // namespace
+
+TEST_CASE("チャンク読み込み順序テスト") {
+    JobSystem jobs(2);
+    TerrainGenerator generator;
+    const ChunkStreamingConfig config = MakeSmallConfig();
+    ChunkStreamer streamer(jobs, generator, config);
+    
+    const std::vector<ChunkCoord>& order = streamer.GetLoadOrder();
+    REQUIRE(order.size() == 5u * 5u * 4u);
+    CHECK(streamer.GetTotalCount() == order.size());
+    
+    SUBCASE("内側のリングから順に、重複無く全チャンクを含む") {
+        std::unordered_set<std::uint64_t> seen;
+        int previousRing = 0;
+        for (const ChunkCoord& coord : order) {
+            const int ring = streamer.GetRing(coord);
+            REQUIRE(ring >= 0);
+            CHECK(ring >= previousRing);
+            previousRing = ring;
+            CHECK(seen.insert(PackChunkCoord(coord)).second);
+        }
+        // 最初の列はスポーン列
+        CHECK(order.front().x == 3);
+        CHECK(order.front().z == -2);
+        CHECK(order.front().y == 5);
+    }
+    
+    SUBCASE("範囲外のリング番号") {
+        CHECK(streamer.GetRing({3, 2, -2}) == 0);
+        CHECK(streamer.GetRing({5, 3, -4}) == 2);
+        CHECK(streamer.GetRing({6, 3, -2}) == -1);
+        CHECK(streamer.GetRing({3, 6, -2}) == -1);
+        CHECK(streamer.GetRing({3, 1, -2}) == -1);
+        CHECK_FALSE(streamer.Contains({0, 3, 0}));
+    }
+    
+    SUBCASE("不正な設定") {
+        ChunkStreamingConfig invalid = config;
+        invalid.maxJobsInFlight = 0;
+        CHECK_THROWS_AS(ChunkStreamer(jobs, generator, invalid), InitializationException);
+        invalid = config;
+        invalid.minChunkY = 6;
+        CHECK_THROWS_AS(ChunkStreamer(jobs, generator, invalid), InitializationException);
+    }
+}
+
+TEST_CASE("チャンク読み込みとメッシュ化可能判定テスト") {
+    JobSystem jobs(2);
+    TerrainSettings settings;
+    settings.seed = 77;
+    TerrainGenerator generator(settings);
+    TerrainGenerator reference(settings);
+    const ChunkStreamingConfig config = MakeSmallConfig();
+    ChunkStreamer streamer(jobs, generator, config);
+    ChunkManager chunks;
+    
+    std::vector<ChunkCoord> loaded;
+    std::vector<ChunkCoord> meshable;
+    std::unordered_set<std::uint64_t> meshableSet;
+    while (streamer.GetLoadedCount() < streamer.GetTotalCount()) {
+        const std::size_t loadedBefore = loaded.size();
+        const std::size_t meshableBefore = meshable.size();
+        streamer.Update(chunks, loaded, meshable);
+        CHECK(streamer.GetJobsInFlight() <= config.maxJobsInFlight);
+        
+        // メッシュ化可能なチャンクは、範囲内の26近傍が全て登録済み
+        for (std::size_t i = meshableBefore; i < meshable.size(); ++i) {
+            const ChunkCoord& coord = meshable[i];
+            CHECK(meshableSet.insert(PackChunkCoord(coord)).second);
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        const ChunkCoord neighbor{coord.x + dx, coord.y + dy, coord.z + dz};
+                        if (streamer.Contains(neighbor)) {
+                            CHECK(chunks.Contains(neighbor));
+                        }
+                    }
+                }
+            }
+        }
+        if (loaded.size() == loadedBefore) {
+            std::this_thread::yield();
+        }
+    }
+    
+    CHECK(loaded.size() == streamer.GetTotalCount());
+    CHECK(meshable.size() == streamer.GetTotalCount());
+    CHECK(chunks.GetChunkCount() == streamer.GetTotalCount());
+    
+    // 生成結果は地形生成器で直接生成したものと一致する
+    for (const ChunkCoord& coord : streamer.GetLoadOrder()) {
+        const Chunk* chunk = chunks.Find(coord);
+        REQUIRE(chunk != nullptr);
+        std::array<BlockId, kChunkVolume> actual{};
+        std::array<BlockId, kChunkVolume> expected{};
+        chunk->Unpack(actual);
+        reference.GenerateChunk(coord)->Unpack(expected);
+        CHECK(actual == expected);
+    }
+    
+    SUBCASE("メッシュ化の通知で内側の範囲・全範囲の完了を判定") {
+        CHECK_FALSE(streamer.IsFirstFrameReady());
+        CHECK_FALSE(streamer.IsComplete());
+        for (const ChunkCoord& coord : streamer.GetLoadOrder()) {
+            if (streamer.GetRing(coord) <= config.firstFrameRadius) {
+                streamer.NotifyMeshed(coord);
+            }
+        }
+        CHECK(streamer.IsFirstFrameReady());
+        CHECK_FALSE(streamer.IsComplete());
+        
+        // 範囲外・重複の通知は無視される
+        streamer.NotifyMeshed({100, 3, 100});
+        streamer.NotifyMeshed(streamer.GetLoadOrder().front());
+        CHECK(streamer.GetMeshedCount() == 3u * 3u * 4u);
+        
+        for (const ChunkCoord& coord : streamer.GetLoadOrder()) {
+            streamer.NotifyMeshed(coord);
+        }
+        CHECK(streamer.IsComplete());
+    }
+}
+
+TEST_CASE("Applicationワールド読み込み統合テスト") {
+    ApplicationConfig config;
+    config.workerThreadCount = 2;
+    config.streamWorld = true;
+    config.streaming = MakeSmallConfig();
+    config.streaming.firstFrameRadius = 0;
+    auto window = std::make_unique<MockWindow>();
+    MockWindow* mock = window.get();
+    Application app(std::move(window), config);
+    
+    const ChunkStreamer* streamer = app.GetChunkStreamer();
+    REQUIRE(streamer != nullptr);
+    CHECK_FALSE(app.GetTimeToFirstFrame().has_value());
+    
+    // 最初のフレームの描画前にスポーン列のメッシュ化を終えている
+    app.RunFrames(1);
+    CHECK(mock->GetSwapBuffersCallCount() == 1);
+    REQUIRE(app.GetTimeToFirstFrame().has_value());
+    CHECK(*app.GetTimeToFirstFrame() >= app.GetStartupTrace().GetTotalSeconds());
+    for (int y = config.streaming.minChunkY; y <= config.streaming.maxChunkY; ++y) {
+        CHECK(app.FindChunkMesh({config.streaming.spawnChunkX, y, config.streaming.spawnChunkZ}) != nullptr);
+    }
+    
+    // 残りはフレームを進めながら読み込む
+    for (int i = 0; i < 10000 && !app.GetTimeToFullViewDistance(); ++i) {
+        app.RunFrames(1);
+    }
+    REQUIRE(app.GetTimeToFullViewDistance().has_value());
+    CHECK(*app.GetTimeToFullViewDistance() >= *app.GetTimeToFirstFrame());
+    CHECK(streamer->IsComplete());
+    CHECK(app.GetChunkManager().GetChunkCount() == streamer->GetTotalCount());
+    for (const ChunkCoord& coord : streamer->GetLoadOrder()) {
+        CHECK(app.FindChunkMesh(coord) != nullptr);
+    }
+    // 新規チャンクのライティングの作業領域はメインスレッドのフレームアリーナから確保される
+    CHECK(app.GetFrameAllocator().GetArena(0).GetHighWaterMark() > 0);
+}
+
+TEST_CASE("Applicationワールド読み込み無効時") {
+    Application app(std::make_unique<MockWindow>());
+    app.RunFrames(2);
+    CHECK(app.GetChunkStreamer() == nullptr);
+    CHECK_FALSE(app.GetTimeToFirstFrame().has_value());
+    CHECK(app.GetChunkManager().GetChunkCount() == 0);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
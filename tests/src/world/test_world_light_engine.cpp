@@ -0,0 +1,230 @@
+#include <doctest/doctest.h>
+#include "core/JobSystem.hpp"
+#include "world/BlockRegistry.hpp"
+#include "world/ChunkManager.hpp"
+#include "world/LightEngine.hpp"
+#include <random>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+std::vector<ChunkCoord> CreateChunks(ChunkManager& chunks, const ChunkCoord& minChunk, const ChunkCoord& maxChunk) {
+    std::vector<ChunkCoord> coords;
+    for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+        for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                chunks.GetOrCreate({cx, cy, cz});
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    return coords;
+}
+
+// 同じブロック配置を最初からライティングした結果と全セルが一致するか
+bool MatchesFullRelight(const ChunkManager& chunks, const LightEngine& light, JobSystem& jobs,
+                        const std::vector<ChunkCoord>& coords) {
+    LightEngine reference(chunks);
+    reference.LightNewChunks(jobs, coords);
+    for (const ChunkCoord& coord : coords) {
+        const ChunkLight* expected = reference.FindChunkLight(coord);
+        const ChunkLight* actual = light.FindChunkLight(coord);
+        if (expected == nullptr || actual == nullptr) {
+            return false;
+        }
+        for (int index = 0; index < kChunkVolume; ++index) {
+            if (expected->Get(LightChannel::Sky, index) != actual->Get(LightChannel::Sky, index) ||
+                expected->Get(LightChannel::Block, index) != actual->Get(LightChannel::Block, index)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("光量ニブル配列テスト") {
+    LightNibbleArray array;
+    array.Set(0, 15);
+    array.Set(1, 3);
+    array.Set(kChunkVolume - 1, 7);
+    CHECK(array.Get(0) == 15);
+    CHECK(array.Get(1) == 3);
+    CHECK(array.Get(2) == 0);
+    CHECK(array.Get(kChunkVolume - 1) == 7);
+    
+    array.Set(0, 1);
+    CHECK(array.Get(0) == 1);
+    CHECK(array.Get(1) == 3);
+    
+    array.Fill(9);
+    CHECK(array.Get(0) == 9);
+    CHECK(array.Get(kChunkVolume - 1) == 9);
+}
+
+TEST_CASE("空の光の初期ライティングテスト") {
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    const std::vector<ChunkCoord> coords = CreateChunks(chunks, {0, 0, 0}, {1, 1, 0});
+    
+    // 屋根の下は横から回り込む光のみが届く
+    for (int z = 4; z <= 8; ++z) {
+        for (int x = 4; x <= 8; ++x) {
+            chunks.SetBlock(x, 20, z, Blocks::Stone);
+        }
+    }
+    
+    LightEngine light(chunks);
+    light.LightNewChunks(jobs, coords);
+    CHECK(light.GetLitChunkCount() == coords.size());
+    CHECK(light.GetChangedChunks().size() == coords.size());
+    
+    SUBCASE("開けた空は真下へ減衰せずに届く") {
+        CHECK(light.GetSkyLight(20, 31, 3) == kMaxLightLevel);
+        CHECK(light.GetSkyLight(20, 0, 3) == kMaxLightLevel);
+        CHECK(light.GetSkyLight(3, 5, 3) == kMaxLightLevel);
+        CHECK(light.GetBlockLight(3, 5, 3) == 0);
+    }
+    
+    SUBCASE("屋根の下は端からの距離だけ減衰する") {
+        CHECK(light.GetSkyLight(6, 20, 6) == 0);
+        CHECK(light.GetSkyLight(6, 19, 6) == kMaxLightLevel - 3);
+        CHECK(light.GetSkyLight(4, 19, 6) == kMaxLightLevel - 1);
+        CHECK(light.GetSkyLight(6, 10, 6) == kMaxLightLevel - 3);
+    }
+    
+    SUBCASE("未ライティングの位置は0") {
+        CHECK(light.GetSkyLight(100, 5, 5) == 0);
+        CHECK(light.FindChunkLight({5, 0, 0}) == nullptr);
+    }
+    
+    SUBCASE("ライティング済みのチャンクは無視する") {
+        light.LightNewChunks(jobs, coords);
+        CHECK(light.GetChangedChunks().empty());
+    }
+}
+
+TEST_CASE("松明の設置と除去テスト") {
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    const std::vector<ChunkCoord> coords = CreateChunks(chunks, {0, 0, 0}, {1, 0, 0});
+    
+    // 空の光が届かないよう全体を埋め、x方向のトンネルのみ掘る（チャンク境界x=16を跨ぐ）
+    for (int y = 0; y < kChunkSize; ++y) {
+        for (int z = 0; z < kChunkSize; ++z) {
+            for (int x = 0; x < kChunkSize * 2; ++x) {
+                const bool tunnel = y == 8 && z == 8 && x >= 2 && x <= 29;
+                chunks.SetBlock(x, y, z, tunnel ? Blocks::Air : Blocks::Stone);
+            }
+        }
+    }
+    
+    LightEngine light(chunks);
+    light.LightNewChunks(jobs, coords);
+    CHECK(light.GetSkyLight(10, 8, 8) == 0);
+    CHECK(light.GetBlockLight(10, 8, 8) == 0);
+    
+    chunks.SetBlock(10, 8, 8, Blocks::Torch);
+    light.MarkBlockChanged(10, 8, 8);
+    CHECK(light.GetPendingEditCount() == 1);
+    light.Update();
+    CHECK(light.GetPendingEditCount() == 0);
+    
+    const std::uint8_t emission = GetBlockLightEmission(Blocks::Torch);
+    CHECK(light.GetBlockLight(10, 8, 8) == emission);
+    CHECK(light.GetBlockLight(11, 8, 8) == emission - 1);
+    CHECK(light.GetBlockLight(5, 8, 8) == emission - 5);
+    // チャンク境界を越えて隣接チャンクへ伝播する
+    CHECK(light.GetBlockLight(16, 8, 8) == emission - 6);
+    CHECK(light.GetBlockLight(23, 8, 8) == emission - 13);
+    CHECK(light.GetBlockLight(24, 8, 8) == 0);
+    // トンネルの外（不透明ブロック）には伝播しない
+    CHECK(light.GetBlockLight(11, 9, 8) == 0);
+    CHECK(light.GetChangedChunks().size() == 2);
+    // 影響範囲のみを辿る（チャンク全体を再計算しない）
+    CHECK(light.GetLastVisitedCount() < static_cast<std::size_t>(kChunkVolume));
+    
+    chunks.SetBlock(10, 8, 8, Blocks::Air);
+    light.MarkBlockChanged(10, 8, 8);
+    light.Update();
+    CHECK(light.GetBlockLight(10, 8, 8) == 0);
+    CHECK(light.GetBlockLight(16, 8, 8) == 0);
+    CHECK(MatchesFullRelight(chunks, light, jobs, coords));
+}
+
+TEST_CASE("隣接チャンクの追加ライティングテスト") {
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    LightEngine light(chunks);
+    
+    // 下のチャンクを先にライティングし、後から上に屋根のあるチャンクを追加する
+    const std::vector<ChunkCoord> lower = CreateChunks(chunks, {0, 0, 0}, {0, 0, 0});
+    light.LightNewChunks(jobs, lower);
+    CHECK(light.GetSkyLight(8, 15, 8) == kMaxLightLevel);
+    
+    const std::vector<ChunkCoord> upper = CreateChunks(chunks, {0, 1, 0}, {0, 1, 0});
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int x = 0; x < kChunkSize; ++x) {
+            if (x < 12) {
+                chunks.SetBlock(x, 20, z, Blocks::Stone);
+            }
+        }
+    }
+    light.LightNewChunks(jobs, upper);
+    
+    CHECK(light.GetSkyLight(8, 25, 8) == kMaxLightLevel);
+    CHECK(light.GetSkyLight(14, 5, 8) == kMaxLightLevel);
+    // 屋根の影が下のチャンクにも落ちる
+    CHECK(light.GetSkyLight(8, 15, 8) == kMaxLightLevel - 4);
+    CHECK(light.GetSkyLight(0, 5, 8) == kMaxLightLevel - 12);
+    
+    std::vector<ChunkCoord> all = lower;
+    all.insert(all.end(), upper.begin(), upper.end());
+    CHECK(MatchesFullRelight(chunks, light, jobs, all));
+}
+
+TEST_CASE("ランダムなブロック変更と全体再計算の一致テスト") {
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    const std::vector<ChunkCoord> coords = CreateChunks(chunks, {-1, -1, -1}, {1, 1, 1});
+    
+    // 起伏のある地形
+    for (int z = -kChunkSize; z < kChunkSize * 2; ++z) {
+        for (int x = -kChunkSize; x < kChunkSize * 2; ++x) {
+            const int height = 4 + (x * 7 + z * 3 + 100) % 9;
+            for (int y = -kChunkSize; y < height; ++y) {
+                chunks.SetBlock(x, y, z, Blocks::Stone);
+            }
+        }
+    }
+    
+    LightEngine light(chunks);
+    light.LightNewChunks(jobs, coords);
+    REQUIRE(MatchesFullRelight(chunks, light, jobs, coords));
+    
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> position(-kChunkSize, kChunkSize * 2 - 1);
+    std::uniform_int_distribution<int> kind(0, 3);
+    for (int batch = 0; batch < 12; ++batch) {
+        // 1回のUpdateに複数の変更をまとめる
+        for (int i = 0; i < 8; ++i) {
+            const int x = position(random);
+            const int y = position(random);
+            const int z = position(random);
+            const int selected = kind(random);
+            const BlockId block = selected == 0 ? Blocks::Torch : selected == 1 ? Blocks::Stone : Blocks::Air;
+            if (chunks.SetBlock(x, y, z, block)) {
+                light.MarkBlockChanged(x, y, z);
+            }
+        }
+        light.Update();
+        CHECK(MatchesFullRelight(chunks, light, jobs, coords));
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
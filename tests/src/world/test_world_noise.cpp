@@ -0,0 +1,146 @@
+#include <doctest/doctest.h>
+#include "core/Exception.hpp"
+#include "world/Noise.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+std::vector<NoiseBackend> GetSupportedBackends() {
+    std::vector<NoiseBackend> backends;
+    for (const NoiseBackend backend : {NoiseBackend::Scalar, NoiseBackend::Sse41, NoiseBackend::Avx2}) {
+        if (IsNoiseBackendSupported(backend)) {
+            backends.push_back(backend);
+        }
+    }
+    return backends;
+}
+
+} // namespace
+
+TEST_CASE("シンプレックスノイズの値域と決定性テスト") {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+    float minimum = 0.0f;
+    float maximum = 0.0f;
+    for (int i = 0; i < 20000; ++i) {
+        const float x = coordinate(random);
+        const float y = coordinate(random);
+        const float z = coordinate(random);
+        const float noise2 = SimplexNoise2D(x, y, 7);
+        const float noise3 = SimplexNoise3D(x, y, z, 7);
+        minimum = std::min({minimum, noise2, noise3});
+        maximum = std::max({maximum, noise2, noise3});
+        REQUIRE(noise3 == SimplexNoise3D(x, y, z, 7));
+    }
+    CHECK(minimum >= -1.05f);
+    CHECK(maximum <= 1.05f);
+    // 値域の大部分を使う
+    CHECK(minimum < -0.6f);
+    CHECK(maximum > 0.6f);
+    
+    // 格子点上では0、シードが変われば別の値
+    CHECK(SimplexNoise3D(0.0f, 0.0f, 0.0f, 1) == doctest::Approx(0.0f));
+    CHECK(SimplexNoise3D(1.3f, 2.7f, -0.4f, 1) != SimplexNoise3D(1.3f, 2.7f, -0.4f, 2));
+    // 連続（近い点は近い値）
+    CHECK(std::abs(SimplexNoise3D(5.0f, 6.0f, 7.0f, 3) - SimplexNoise3D(5.001f, 6.0f, 7.0f, 3)) < 0.01f);
+}
+
+TEST_CASE("ノイズのまとめ評価は全命令セットでスカラー版と一致するテスト") {
+    // SIMDの幅で割り切れない個数にして端数の処理も確かめる
+    constexpr std::size_t kCount = 1003;
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> coordinate(-300.0f, 300.0f);
+    std::vector<float> x(kCount);
+    std::vector<float> y(kCount);
+    std::vector<float> z(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        x[i] = coordinate(random);
+        y[i] = coordinate(random);
+        z[i] = coordinate(random);
+    }
+    
+    std::vector<float> out2(kCount);
+    std::vector<float> out3(kCount);
+    for (const NoiseBackend backend : GetSupportedBackends()) {
+        CAPTURE(GetNoiseBackendName(backend));
+        SimplexNoise2D(x, y, out2, 11, backend);
+        SimplexNoise3D(x, y, z, out3, 11, backend);
+        for (std::size_t i = 0; i < kCount; ++i) {
+            REQUIRE(out2[i] == SimplexNoise2D(x[i], y[i], 11));
+            REQUIRE(out3[i] == SimplexNoise3D(x[i], y[i], z[i], 11));
+        }
+    }
+    
+    CHECK(IsNoiseBackendSupported(NoiseBackend::Scalar));
+    CHECK(IsNoiseBackendSupported(GetBestNoiseBackend()));
+    std::vector<float> shorter(kCount - 1);
+    CHECK_THROWS_AS(SimplexNoise3D(x, y, z, shorter, 11), BoxelGameException);
+}
+
+TEST_CASE("fBm格子ノイズテスト") {
+    FractalNoiseSettings settings;
+    settings.seed = 99;
+    settings.octaves = 5;
+    settings.frequency = 1.0f / 32.0f;
+    
+    SUBCASE("3D格子は各点の評価と一致し、全命令セットで同じ") {
+        std::vector<float> reference(16 * 16 * 16);
+        FractalNoise3DGrid(settings, -16, 32, 48, 16, 16, 16, reference, NoiseBackend::Scalar);
+        
+        // 1点ずつ評価した値（x最内、次にz、最外y）
+        float expected = 0.0f;
+        float frequency = settings.frequency;
+        float amplitude = 1.0f;
+        float total = 0.0f;
+        for (int octave = 0; octave < settings.octaves; ++octave) {
+            expected += amplitude * SimplexNoise3D((-16 + 3) * frequency, (32 + 5) * frequency, (48 + 7) * frequency,
+                                                   settings.seed + static_cast<std::uint32_t>(octave));
+            total += amplitude;
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+        CHECK(reference[3 + 7 * 16 + 5 * 256] == doctest::Approx(expected / total).epsilon(1e-5));
+        
+        std::vector<float> grid(reference.size());
+        for (const NoiseBackend backend : GetSupportedBackends()) {
+            CAPTURE(GetNoiseBackendName(backend));
+            FractalNoise3DGrid(settings, -16, 32, 48, 16, 16, 16, grid, backend);
+            CHECK(grid == reference);
+        }
+        for (const float value : reference) {
+            REQUIRE(std::abs(value) <= 1.05f);
+        }
+    }
+    
+    SUBCASE("隣接する2D格子は境界で連続する") {
+        std::vector<float> wide(32 * 16);
+        std::vector<float> left(16 * 16);
+        std::vector<float> right(16 * 16);
+        FractalNoise2DGrid(settings, 0, 0, 32, 16, wide);
+        FractalNoise2DGrid(settings, 0, 0, 16, 16, left);
+        FractalNoise2DGrid(settings, 16, 0, 16, 16, right);
+        for (int z = 0; z < 16; ++z) {
+            for (int x = 0; x < 16; ++x) {
+                REQUIRE(wide[x + z * 32] == left[x + z * 16]);
+                REQUIRE(wide[16 + x + z * 32] == right[x + z * 16]);
+            }
+        }
+    }
+    
+    SUBCASE("不正な設定") {
+        std::vector<float> grid(16);
+        settings.octaves = 0;
+        CHECK_THROWS_AS(FractalNoise2DGrid(settings, 0, 0, 4, 4, grid), BoxelGameException);
+        settings.octaves = 1;
+        CHECK_THROWS_AS(FractalNoise2DGrid(settings, 0, 0, 8, 4, grid), BoxelGameException);
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
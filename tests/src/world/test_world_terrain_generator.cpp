@@ -0,0 +1,183 @@
+#include <doctest/doctest.h>
+#include "world/TerrainGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+std::array<BlockId, kChunkVolume> UnpackBlocks(const Chunk& chunk) {
+    std::array<BlockId, kChunkVolume> blocks{};
+    chunk.Unpack(blocks);
+    return blocks;
+}
+
+} // namespace
+
+TEST_CASE("地形生成はスレッド数・順序に依存しないテスト") {
+    TerrainSettings settings;
+    settings.seed = 2024;
+    TerrainGenerator generator(settings);
+    
+    std::vector<ChunkCoord> coords;
+    for (int cy = 2; cy <= 5; ++cy) {
+        for (int cz = -2; cz <= 1; ++cz) {
+            for (int cx = -2; cx <= 1; ++cx) {
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    
+    // 1スレッドで順に生成した結果を基準にする
+    std::vector<std::array<BlockId, kChunkVolume>> reference;
+    for (const ChunkCoord& coord : coords) {
+        reference.push_back(UnpackBlocks(*generator.GenerateChunk(coord)));
+    }
+    
+    SUBCASE("複数スレッド・逆順") {
+        JobSystem jobs(3);
+        std::vector<ChunkCoord> reversed(coords.rbegin(), coords.rend());
+        const std::vector<std::unique_ptr<Chunk>> chunks = generator.GenerateChunks(jobs, reversed);
+        REQUIRE(chunks.size() == coords.size());
+        for (std::size_t i = 0; i < coords.size(); ++i) {
+            REQUIRE(UnpackBlocks(*chunks[coords.size() - 1 - i]) == reference[i]);
+        }
+    }
+    
+    SUBCASE("別の生成器でも同じシードなら同じ") {
+        const TerrainGenerator other(settings);
+        for (std::size_t i = 0; i < coords.size(); i += 7) {
+            REQUIRE(UnpackBlocks(*other.GenerateChunk(coords[i])) == reference[i]);
+        }
+    }
+    
+    SUBCASE("シードが変われば別の地形") {
+        settings.seed = 2025;
+        const TerrainGenerator other(settings);
+        bool differs = false;
+        for (std::size_t i = 0; i < coords.size() && !differs; ++i) {
+            differs = UnpackBlocks(*other.GenerateChunk(coords[i])) != reference[i];
+        }
+        CHECK(differs);
+    }
+}
+
+TEST_CASE("地形の形状テスト") {
+    TerrainSettings settings;
+    settings.seed = 7;
+    TerrainGenerator generator(settings);
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    
+    std::vector<ChunkCoord> coords;
+    for (int cy = 0; cy < 10; ++cy) {
+        coords.push_back({0, cy, 0});
+    }
+    generator.GenerateInto(jobs, coords, chunks);
+    CHECK(chunks.GetChunkCount() == coords.size());
+    
+    // 地表より十分高い所は空気、十分深い所は石のみ
+    const float maxHeight = settings.baseHeight + settings.heightAmplitude + settings.densityAmplitude;
+    const float minHeight = settings.baseHeight - settings.heightAmplitude - settings.densityAmplitude;
+    CHECK(chunks.Find({0, 9, 0})->IsEmpty());
+    CHECK(static_cast<float>(9 * kChunkSize) > maxHeight);
+    const Chunk* deep = chunks.Find({0, 0, 0});
+    CHECK(deep->IsUniform());
+    CHECK(deep->GetUniformBlock() == Blocks::Stone);
+    CHECK(static_cast<float>(kChunkSize) < minHeight - static_cast<float>(settings.dirtDepth));
+    
+    // 各列の最上部の地面は草で、地表の高さから3Dノイズの振れ幅以内にある
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int x = 0; x < kChunkSize; ++x) {
+            int top = kChunkSize * 10 - 1;
+            while (top >= 0 && chunks.GetBlock(x, top, z) == Blocks::Air) {
+                --top;
+            }
+            REQUIRE(top >= 0);
+            CHECK(chunks.GetBlock(x, top, z) == Blocks::Grass);
+            CHECK(std::abs(static_cast<float>(top) - generator.GetSurfaceHeight(x, z)) <=
+                  settings.densityAmplitude + 1.0f);
+        }
+    }
+}
+
+TEST_CASE("列の高さマップによる一様チャンクの省略テスト") {
+    TerrainSettings settings;
+    settings.seed = 31;
+    TerrainGenerator generator(settings);
+    settings.skipUniformChunks = false;
+    TerrainGenerator reference(settings);
+    JobSystem jobs(2);
+    
+    // 高さ256のワールドの2×2列
+    std::vector<ChunkCoord> coords;
+    for (int cy = 0; cy < 16; ++cy) {
+        for (int cz = -1; cz <= 0; ++cz) {
+            for (int cx = 0; cx <= 1; ++cx) {
+                coords.push_back({cx, cy, cz});
+            }
+        }
+    }
+    const std::vector<std::unique_ptr<Chunk>> chunks = generator.GenerateChunks(jobs, coords);
+    const std::vector<std::unique_ptr<Chunk>> expected = reference.GenerateChunks(jobs, coords);
+    for (std::size_t i = 0; i < coords.size(); ++i) {
+        CAPTURE(coords[i].y);
+        REQUIRE(UnpackBlocks(*chunks[i]) == UnpackBlocks(*expected[i]));
+    }
+    
+    // 大部分のチャンクは3Dノイズを評価せずに済む
+    const TerrainGenerator::Stats stats = generator.GetStats();
+    CHECK(stats.airChunks + stats.solidChunks + stats.noiseChunks == coords.size());
+    CHECK(stats.airChunks > stats.noiseChunks);
+    CHECK(stats.solidChunks > 0);
+    CHECK(reference.GetStats().noiseChunks == coords.size());
+    
+    // 高さマップは列ごとに1回だけ求める
+    CHECK(generator.GetCachedColumnCount() == 4);
+    const ColumnHeightmap* column = generator.FindColumn(1, -1);
+    REQUIRE(column != nullptr);
+    CHECK(column->minHeight <= column->maxHeight);
+    const float cachedHeight = column->GetHeight(5, 9);
+    CHECK(generator.GetSurfaceHeight(16 + 5, -16 + 9) == cachedHeight);
+    generator.EvictColumn(1, -1);
+    CHECK(generator.FindColumn(1, -1) == nullptr);
+    // キャッシュの有無で値は変わらない
+    CHECK(generator.GetSurfaceHeight(16 + 5, -16 + 9) == cachedHeight);
+    const ColumnHeightmap& recomputed = generator.GetColumn(1, -1);
+    CHECK(generator.FindColumn(1, -1) == &recomputed);
+    CHECK(recomputed.GetHeight(5, 9) == cachedHeight);
+}
+
+TEST_CASE("スポーン位置・空の光向けの高さ問い合わせテスト") {
+    TerrainSettings settings;
+    settings.seed = 5;
+    TerrainGenerator generator(settings);
+    JobSystem jobs(2);
+    ChunkManager chunks;
+    
+    std::vector<ChunkCoord> coords;
+    for (int cy = 0; cy < 16; ++cy) {
+        coords.push_back({-1, cy, 2});
+    }
+    generator.GenerateInto(jobs, coords, chunks);
+    
+    const int maxSolidY = generator.GetMaxSolidY(*generator.FindColumn(-1, 2));
+    for (int z = 32; z < 48; z += 3) {
+        for (int x = -16; x < 0; x += 3) {
+            int top = kChunkSize * 16 - 1;
+            while (top >= 0 && chunks.GetBlock(x, top, z) == Blocks::Air) {
+                --top;
+            }
+            CHECK(generator.FindTopSolidY(x, z) == top);
+            CHECK(top <= maxSolidY);
+        }
+    }
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <doctest/doctest.h>
+#include "world/VoxelRaycast.hpp"
+#include "core/Exception.hpp"
+#include "world/BlockRegistry.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace BoxelGame {
+namespace Test {
+
+namespace {
+
+VoxelRay MakeRay(float ox, float oy, float oz, float dx, float dy, float dz, float maxDistance = 64.0f) {
+    VoxelRay ray;
+    ray.origin[0] = ox;
+    ray.origin[1] = oy;
+    ray.origin[2] = oz;
+    ray.direction[0] = dx;
+    ray.direction[1] = dy;
+    ray.direction[2] = dz;
+    ray.maxDistance = maxDistance;
+    return ray;
+}
+
+bool IsBlock(const VoxelRaycastHit& hit, int x, int y, int z) {
+    return hit.hit && hit.block[0] == x && hit.block[1] == y && hit.block[2] == z;
+}
+
+} // namespace
+
+TEST_CASE("ボクセルレイキャスト基本テスト") {
+    ChunkManager chunks;
+    chunks.GetOrCreate({0, 0, 0});
+    chunks.GetOrCreate({-1, 0, 0});
+    chunks.GetOrCreate({1, 0, 0});
+    
+    SUBCASE("軸方向のレイは入った面と距離を返す") {
+        chunks.SetBlock(10, 5, 5, Blocks::Stone);
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, MakeRay(2.5f, 5.5f, 5.5f, 1.0f, 0.0f, 0.0f));
+        CHECK(IsBlock(hit, 10, 5, 5));
+        CHECK(hit.blockId == Blocks::Stone);
+        CHECK(hit.face == BlockFace::NegativeX);
+        CHECK(hit.distance == doctest::Approx(7.5f));
+        
+        // 逆向き・正規化していない方向
+        const VoxelRaycastHit back = RaycastVoxels(chunks, MakeRay(14.25f, 5.5f, 5.5f, -3.0f, 0.0f, 0.0f));
+        CHECK(IsBlock(back, 10, 5, 5));
+        CHECK(back.face == BlockFace::PositiveX);
+        CHECK(back.distance == doctest::Approx(3.25f));
+    }
+    
+    SUBCASE("上下方向の面") {
+        chunks.SetBlock(3, 2, 3, Blocks::Dirt);
+        const VoxelRaycastHit down = RaycastVoxels(chunks, MakeRay(3.5f, 12.0f, 3.5f, 0.0f, -1.0f, 0.0f));
+        CHECK(IsBlock(down, 3, 2, 3));
+        CHECK(down.face == BlockFace::PositiveY);
+        CHECK(down.distance == doctest::Approx(9.0f));
+    }
+    
+    SUBCASE("斜めのレイがチャンク境界をまたぐ") {
+        chunks.SetBlock(-3, 9, 4, Blocks::Wood);
+        // (-3.5, 9.5, 4.5) へ向かう
+        const float ox = 6.5f;
+        const float oy = 4.5f;
+        const float oz = 4.5f;
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, MakeRay(ox, oy, oz, -10.0f, 5.0f, 0.0f));
+        CHECK(IsBlock(hit, -3, 9, 4));
+        CHECK(hit.blockId == Blocks::Wood);
+        // 入った点はブロックの表面上
+        const float length = std::sqrt(125.0f);
+        const float px = ox - 10.0f / length * hit.distance;
+        const float py = oy + 5.0f / length * hit.distance;
+        const bool onXFace = std::abs(px - (-2.0f)) < 1e-3f;
+        const bool onYFace = std::abs(py - 9.0f) < 1e-3f;
+        CHECK((onXFace || onYFace));
+        CHECK(hit.face == (onXFace ? BlockFace::PositiveX : BlockFace::NegativeY));
+    }
+    
+    SUBCASE("最大距離で打ち切る") {
+        chunks.SetBlock(10, 5, 5, Blocks::Stone);
+        CHECK_FALSE(RaycastVoxels(chunks, MakeRay(2.5f, 5.5f, 5.5f, 1.0f, 0.0f, 0.0f, 7.0f)).hit);
+        CHECK(RaycastVoxels(chunks, MakeRay(2.5f, 5.5f, 5.5f, 1.0f, 0.0f, 0.0f, 7.5f)).hit);
+    }
+    
+    SUBCASE("未ロードのチャンクは空気として通過する") {
+        chunks.GetOrCreate({3, 0, 0}).Fill(Blocks::Stone);
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, MakeRay(8.5f, 8.5f, 8.5f, 1.0f, 0.0f, 0.0f));
+        CHECK(IsBlock(hit, 48, 8, 8));
+        CHECK(hit.distance == doctest::Approx(39.5f));
+    }
+    
+    SUBCASE("フィルタ: 不透明ブロックのみ") {
+        chunks.SetBlock(5, 5, 5, Blocks::Glass);
+        chunks.SetBlock(8, 5, 5, Blocks::Stone);
+        VoxelRay ray = MakeRay(0.5f, 5.5f, 5.5f, 1.0f, 0.0f, 0.0f);
+        CHECK(IsBlock(RaycastVoxels(chunks, ray), 5, 5, 5));
+        ray.filter = RaycastFilter::Opaque;
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, ray);
+        CHECK(hit.blockId == (IsOpaqueBlock(Blocks::Glass) ? Blocks::Glass : Blocks::Stone));
+    }
+    
+    SUBCASE("始点がブロック内") {
+        chunks.SetBlock(4, 4, 4, Blocks::Sand);
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, MakeRay(4.5f, 4.5f, 4.5f, 0.0f, 0.0f, -1.0f));
+        CHECK(IsBlock(hit, 4, 4, 4));
+        CHECK(hit.distance == 0.0f);
+        CHECK(hit.face == BlockFace::PositiveZ);
+    }
+    
+    SUBCASE("長さ0・不正なレイ") {
+        chunks.SetBlock(4, 4, 4, Blocks::Sand);
+        CHECK_FALSE(RaycastVoxels(chunks, MakeRay(4.5f, 4.5f, 4.5f, 0.0f, 0.0f, 0.0f)).hit);
+        CHECK_FALSE(RaycastVoxels(chunks, MakeRay(4.5f, 4.5f, 4.5f, 1.0f, 0.0f, 0.0f, -1.0f)).hit);
+        CHECK_THROWS_AS(RaycastVoxels(chunks, MakeRay(0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f,
+                                                      std::numeric_limits<float>::infinity())),
+                        BoxelGameException);
+    }
+}
+
+TEST_CASE("ボクセルレイキャストの細かい刻みによる照合と一括処理テスト") {
+    ChunkManager chunks;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> coordinate(-24, 23);
+    for (int cy = -2; cy <= 1; ++cy) {
+        for (int cz = -2; cz <= 1; ++cz) {
+            for (int cx = -2; cx <= 1; ++cx) {
+                chunks.GetOrCreate({cx, cy, cz});
+            }
+        }
+    }
+    for (int i = 0; i < 600; ++i) {
+        chunks.SetBlock(coordinate(random), coordinate(random), coordinate(random), Blocks::Stone);
+    }
+    
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+    std::vector<VoxelRay> rays;
+    for (int i = 0; i < 300; ++i) {
+        rays.push_back(MakeRay(position(random), position(random), position(random), direction(random),
+                               direction(random), direction(random), 40.0f));
+    }
+    
+    std::vector<VoxelRaycastHit> serial;
+    int hitCount = 0;
+    for (const VoxelRay& ray : rays) {
+        const VoxelRaycastHit hit = RaycastVoxels(chunks, ray);
+        serial.push_back(hit);
+        hitCount += hit.hit ? 1 : 0;
+        
+        // 当たった距離の手前を細かく刻んだ点は全て空気、当たった点の少し先は当たったブロック内
+        const float length = std::sqrt(ray.direction[0] * ray.direction[0] + ray.direction[1] * ray.direction[1] +
+                                       ray.direction[2] * ray.direction[2]);
+        const float limit = hit.hit ? hit.distance : ray.maxDistance;
+        bool clear = true;
+        for (float t = 0.0f; t < limit - 1e-3f; t += 0.01f) {
+            const auto at = [&](int axis) {
+                return static_cast<int>(std::floor(ray.origin[axis] + ray.direction[axis] / length * t));
+            };
+            clear = clear && chunks.GetBlock(at(0), at(1), at(2)) == Blocks::Air;
+        }
+        CHECK(clear);
+        if (hit.hit) {
+            const float t = hit.distance + 1e-3f;
+            const auto at = [&](int axis) {
+                return static_cast<int>(std::floor(ray.origin[axis] + ray.direction[axis] / length * t));
+            };
+            CHECK(IsBlock(hit, at(0), at(1), at(2)));
+            CHECK(chunks.GetBlock(at(0), at(1), at(2)) == Blocks::Stone);
+        }
+    }
+    CHECK(hitCount > 0);
+    CHECK(hitCount < static_cast<int>(rays.size()));
+    
+    // 一括処理はレイごとに調べた結果と一致する
+    JobSystem jobs(3);
+    std::vector<VoxelRaycastHit> batch(rays.size());
+    RaycastVoxels(jobs, chunks, rays, batch);
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        CHECK(batch[i].hit == serial[i].hit);
+        CHECK(batch[i].blockId == serial[i].blockId);
+        CHECK(batch[i].face == serial[i].face);
+        CHECK(batch[i].distance == serial[i].distance);
+        CHECK(IsBlock(batch[i], serial[i].block[0], serial[i].block[1], serial[i].block[2]) == serial[i].hit);
+    }
+    
+    std::vector<VoxelRaycastHit> tooSmall(rays.size() - 1);
+    CHECK_THROWS_AS(RaycastVoxels(jobs, chunks, rays, tooSmall), BoxelGameException);
+}
+
+} // namespace Test
+} // namespace BoxelGame
\ No newline at end of file